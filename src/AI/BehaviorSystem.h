@@ -4,6 +4,7 @@
 #include <string>
 #include <tensorflow/core/public/session.h>
 #include "PersonalitySystem.h"
+#include "../Core/CoroutineScheduler.h"
 
 namespace ForgeEngine {
 namespace AI {
@@ -36,6 +37,15 @@ public:
         loadModel();
     }
 
+    // Reads the model file and creates the session on a worker thread, so
+    // start-up doesn't stall the frame. Throws like the constructor does.
+    static Core::Task<std::unique_ptr<BehaviorSystem>> loadAsync(Core::CoroutineScheduler& scheduler) {
+        co_await scheduler.schedule();
+        std::unique_ptr<BehaviorSystem> system(new BehaviorSystem(DeferredLoad{}));
+        system->loadModel();
+        co_return system;
+    }
+
     ActionType predictAction(const PersonalityProfile& personality, const BehaviorContext& context) {
         // Convert personality and context to tensor input
         std::vector<float> input = prepareInput(personality, context);
@@ -71,6 +81,13 @@ public:
 private:
     std::unique_ptr<tensorflow::Session> session;
 
+    struct DeferredLoad {};
+
+    explicit BehaviorSystem(DeferredLoad) {
+        tensorflow::SessionOptions options;
+        session = std::unique_ptr<tensorflow::Session>(tensorflow::NewSession(options));
+    }
+
     void loadModel() {
         // Load pre-trained model
         tensorflow::GraphDef graph_def;
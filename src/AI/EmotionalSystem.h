@@ -3,12 +3,24 @@
 #include <vector>
 #include <memory>
 #include <cmath>
+#include <span>
 #include "PersonalitySystem.h"
 #include "../Core/Profiler.h"
+#include "../Core/Symbol.h"
 
 namespace ForgeEngine {
 namespace AI {
 
+// Event names understood by the emotional systems, interned once
+struct EmotionalEvents {
+    inline static const Core::Symbol PositiveSocialInteraction{"Positive_Social_Interaction"};
+    inline static const Core::Symbol ThreatDetected{"Threat_Detected"};
+    inline static const Core::Symbol Conflict{"Conflict_Event"};
+    inline static const Core::Symbol IntenseConflict{"Intense_Conflict_Event"};
+    inline static const Core::Symbol Social{"Social_Event"};
+    inline static const Core::Symbol EnhancedSocial{"Enhanced_Social_Event"};
+};
+
 enum class EmotionType {
     Joy,
     Sadness,
@@ -42,7 +54,7 @@ public:
         }
     }
 
-    void updateEmotions(float deltaTime, const std::vector<std::string>& events) {
+    void updateEmotions(float deltaTime, std::span<const Core::Symbol> events) {
         PROFILE_SCOPE("EmotionalState_Update");
         
         // Natural decay
@@ -51,7 +63,7 @@ public:
         }
 
         // Process events
-        for (const auto& event : events) {
+        for (Core::Symbol event : events) {
             processEmotionalEvent(event);
         }
 
@@ -84,13 +96,13 @@ public:
 private:
     std::unordered_map<EmotionType, Emotion> emotions;
 
-    void processEmotionalEvent(const std::string& event) {
+    void processEmotionalEvent(Core::Symbol event) {
         // Example event processing
-        if (event == "Positive_Social_Interaction") {
+        if (event == EmotionalEvents::PositiveSocialInteraction) {
             emotions[EmotionType::Joy].intensity += 0.2f;
             emotions[EmotionType::Trust].intensity += 0.1f;
         }
-        else if (event == "Threat_Detected") {
+        else if (event == EmotionalEvents::ThreatDetected) {
             emotions[EmotionType::Fear].intensity += 0.3f;
             emotions[EmotionType::Anticipation].intensity += 0.2f;
         }
@@ -119,14 +131,15 @@ public:
     void updateNPCEmotions(
         PersonalityProfile& personality,
         EmotionalState& emotionalState,
-        const std::vector<std::string>& events,
+        std::span<const Core::Symbol> events,
         float deltaTime
     ) {
         PROFILE_SCOPE("EmotionalResponseSystem_Update");
 
         // Personality affects emotional responses
-        std::vector<std::string> modifiedEvents;
-        for (const auto& event : events) {
+        std::vector<Core::Symbol> modifiedEvents;
+        modifiedEvents.reserve(events.size());
+        for (Core::Symbol event : events) {
             modifyEventBasedOnPersonality(event, personality, modifiedEvents);
         }
 
@@ -134,11 +147,11 @@ public:
         emotionalState.updateEmotions(deltaTime, modifiedEvents);
     }
 
-    std::vector<std::string> generateEmotionalResponses(
+    std::vector<Core::Symbol> generateEmotionalResponses(
         const EmotionalState& emotionalState,
         const PersonalityProfile& personality
     ) {
-        std::vector<std::string> responses;
+        std::vector<Core::Symbol> responses;
         
         auto dominantEmotions = emotionalState.getDominantEmotions();
         for (const auto& [emotion, intensity] : dominantEmotions) {
@@ -152,41 +165,47 @@ public:
 
 private:
     void modifyEventBasedOnPersonality(
-        const std::string& event,
+        Core::Symbol event,
         const PersonalityProfile& personality,
-        std::vector<std::string>& modifiedEvents
+        std::vector<Core::Symbol>& modifiedEvents
     ) {
         // Personality traits affect emotional response intensity
         float aggressionLevel = personality.getTraitValue(PersonalityTrait::Type::AGGRESSION);
         float diplomaticLevel = personality.getTraitValue(PersonalityTrait::Type::DIPLOMACY);
 
-        if (event == "Conflict_Event" && aggressionLevel > 0.7f) {
-            modifiedEvents.push_back("Intense_" + event);
+        if (event == EmotionalEvents::Conflict && aggressionLevel > 0.7f) {
+            modifiedEvents.push_back(EmotionalEvents::IntenseConflict);
         }
-        else if (event == "Social_Event" && diplomaticLevel > 0.7f) {
-            modifiedEvents.push_back("Enhanced_" + event);
+        else if (event == EmotionalEvents::Social && diplomaticLevel > 0.7f) {
+            modifiedEvents.push_back(EmotionalEvents::EnhancedSocial);
         }
         else {
             modifiedEvents.push_back(event);
         }
     }
 
-    std::string generateResponseForEmotion(
+    Core::Symbol generateResponseForEmotion(
         EmotionType emotion,
         float intensity,
         const PersonalityProfile& personality
     ) {
+        static const Core::Symbol controlledAnger("Controlled_Anger");
+        static const Core::Symbol aggressiveResponse("Aggressive_Response");
+        static const Core::Symbol expressiveJoy("Expressive_Joy");
+        static const Core::Symbol reservedJoy("Reserved_Joy");
+        static const Core::Symbol neutralResponse("Neutral_Response");
+
         // Generate appropriate responses based on emotion and personality
         switch (emotion) {
             case EmotionType::Anger:
                 return personality.getTraitValue(PersonalityTrait::Type::DIPLOMACY) > 0.7f ?
-                    "Controlled_Anger" : "Aggressive_Response";
+                    controlledAnger : aggressiveResponse;
             case EmotionType::Joy:
                 return personality.getTraitValue(PersonalityTrait::Type::EXTROVERSION) > 0.7f ?
-                    "Expressive_Joy" : "Reserved_Joy";
+                    expressiveJoy : reservedJoy;
             // Add more emotion-specific responses
             default:
-                return "Neutral_Response";
+                return neutralResponse;
         }
     }
 };
@@ -1,6 +1,7 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <queue>
 #include <random>
 #include "../Core/ThreadPool.h"
@@ -82,6 +83,20 @@ public:
         return current;
     }
 
+    // Same events without copying them; the vector lives in resource,
+    // typically FrameArena::local()
+    std::pmr::vector<const StoryEvent*> getCurrentEvents(std::pmr::memory_resource* resource) const {
+        std::pmr::vector<const StoryEvent*> current(resource);
+        for (const auto& arc : activeStoryArcs) {
+            for (const auto& event : arc.events) {
+                if (!event.requiresResolution) {
+                    current.push_back(&event);
+                }
+            }
+        }
+        return current;
+    }
+
     void addCharacterToStory(const std::string& npcId, const std::string& arcName) {
         auto it = std::find_if(
             activeStoryArcs.begin(),
@@ -231,7 +246,7 @@ private:
                 StoryEvent event{
                     StoryEvent::Type::Technological,
                     "Technology Breakthrough",
-                    "New discovery: " + tech->name,
+                    "New discovery: " + tech->name.str(),
                     0.8f,
                     0.6f,
                     {},
@@ -0,0 +1,161 @@
+#include "AllocationTracker.h"
+
+#ifdef FORGE_TRACK_ALLOCATIONS
+
+#include <cstdlib>
+#include <new>
+
+// Global operator new/delete replacements that feed AllocationTracker. Each
+// block carries a small header in front of the user pointer recording its
+// size and owning zone, so frees are charged back correctly even when the
+// block is released on another thread or from a different zone.
+
+namespace {
+
+using ForgeEngine::Core::AllocationTracker;
+using ForgeEngine::Core::Profiler;
+
+struct AllocationHeader {
+    uint64_t size;
+    uint32_t zone;
+    uint32_t offset;  // distance from the start of the underlying block
+};
+
+constexpr size_t HeaderSize = 16;
+static_assert(sizeof(AllocationHeader) == HeaderSize);
+static_assert(HeaderSize >= alignof(std::max_align_t));
+
+AllocationHeader* headerOf(void* ptr) {
+    return reinterpret_cast<AllocationHeader*>(static_cast<char*>(ptr) - HeaderSize);
+}
+
+void* finishAllocation(void* block, size_t offset, size_t size) {
+    void* ptr = static_cast<char*>(block) + offset;
+    const uint32_t zone = Profiler::currentZone();
+    *headerOf(ptr) = AllocationHeader{size, zone, static_cast<uint32_t>(offset)};
+    AllocationTracker::recordAllocation(zone, size);
+    return ptr;
+}
+
+void* trackedAllocate(size_t size) noexcept {
+    void* block = std::malloc(HeaderSize + size);
+    return block ? finishAllocation(block, HeaderSize, size) : nullptr;
+}
+
+void* trackedAllocateAligned(size_t size, std::align_val_t alignment) noexcept {
+    const size_t align = static_cast<size_t>(alignment);
+    if (align <= HeaderSize) {
+        return trackedAllocate(size);
+    }
+    // Reserve a whole alignment unit in front so the header fits and the
+    // user pointer stays aligned
+    const size_t total = (align + size + align - 1) / align * align;
+#ifdef _MSC_VER
+    void* block = _aligned_malloc(total, align);
+#else
+    void* block = std::aligned_alloc(align, total);
+#endif
+    return block ? finishAllocation(block, align, size) : nullptr;
+}
+
+void* releaseTracked(void* ptr) noexcept {
+    const AllocationHeader header = *headerOf(ptr);
+    AllocationTracker::recordFree(header.zone, header.size);
+    return static_cast<char*>(ptr) - header.offset;
+}
+
+void trackedFree(void* ptr) noexcept {
+    if (ptr) {
+        std::free(releaseTracked(ptr));
+    }
+}
+
+void trackedFreeAligned(void* ptr, std::align_val_t alignment) noexcept {
+    if (!ptr) {
+        return;
+    }
+    if (static_cast<size_t>(alignment) <= HeaderSize) {
+        trackedFree(ptr);
+        return;
+    }
+#ifdef _MSC_VER
+    _aligned_free(releaseTracked(ptr));
+#else
+    std::free(releaseTracked(ptr));
+#endif
+}
+
+void* allocateOrThrow(size_t size) {
+    // Same retry loop as the standard operator new
+    while (true) {
+        if (void* ptr = trackedAllocate(size)) {
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void* allocateAlignedOrThrow(size_t size, std::align_val_t alignment) {
+    while (true) {
+        if (void* ptr = trackedAllocateAligned(size, alignment)) {
+            return ptr;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+} // namespace
+
+void* operator new(size_t size) { return allocateOrThrow(size); }
+void* operator new[](size_t size) { return allocateOrThrow(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size); }
+
+void* operator new(size_t size, std::align_val_t alignment) {
+    return allocateAlignedOrThrow(size, alignment);
+}
+void* operator new[](size_t size, std::align_val_t alignment) {
+    return allocateAlignedOrThrow(size, alignment);
+}
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return trackedAllocateAligned(size, alignment);
+}
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return trackedAllocateAligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+    trackedFreeAligned(ptr, alignment);
+}
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+    trackedFreeAligned(ptr, alignment);
+}
+void operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept {
+    trackedFreeAligned(ptr, alignment);
+}
+void operator delete[](void* ptr, size_t, std::align_val_t alignment) noexcept {
+    trackedFreeAligned(ptr, alignment);
+}
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    trackedFreeAligned(ptr, alignment);
+}
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    trackedFreeAligned(ptr, alignment);
+}
+
+#endif // FORGE_TRACK_ALLOCATIONS
@@ -0,0 +1,154 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <spdlog/spdlog.h>
+#include "Profiler.h"
+
+namespace ForgeEngine {
+namespace Core {
+
+// Per-zone heap accounting. When the engine is built with
+// FORGE_TRACK_ALLOCATIONS, AllocationTracker.cpp replaces the global
+// operator new/delete and charges every allocation to the profiler zone that
+// is current on the allocating thread (the innermost PROFILE_SCOPE or
+// MEMORY_TAG). Frees are charged back to the zone that made the allocation,
+// whichever thread releases it.
+//
+// Without the option nothing is recorded and report() is empty, so callers
+// need no #ifdefs.
+class AllocationTracker {
+public:
+    struct ZoneMemory {
+        std::string name;
+        int64_t liveBytes;
+        int64_t peakBytes;
+        uint64_t totalAllocations;
+        uint64_t allocationsPerFrame;  // during the last completed frame
+        uint64_t bytesPerFrame;
+    };
+
+    static constexpr bool enabled() {
+#ifdef FORGE_TRACK_ALLOCATIONS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // Called by the replaced operator new; must not allocate
+    static void recordAllocation(uint32_t zoneId, size_t size) {
+        ZoneCounters& zone = counters()[clampZone(zoneId)];
+        zone.allocations.fetch_add(1, std::memory_order_relaxed);
+        zone.allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        const int64_t live = zone.liveBytes.fetch_add(static_cast<int64_t>(size),
+                                                      std::memory_order_relaxed) +
+                             static_cast<int64_t>(size);
+        int64_t peak = zone.peakBytes.load(std::memory_order_relaxed);
+        while (live > peak &&
+               !zone.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    static void recordFree(uint32_t zoneId, size_t size) {
+        counters()[clampZone(zoneId)].liveBytes.fetch_sub(static_cast<int64_t>(size),
+                                                          std::memory_order_relaxed);
+    }
+
+    // Closes the current frame's allocation window; call once per frame after
+    // Profiler::endFrame()
+    static void endFrame() {
+        if (!enabled()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(frameMutex());
+        for (ZoneCounters& zone : counters()) {
+            const uint64_t allocations = zone.allocations.load(std::memory_order_relaxed);
+            const uint64_t bytes = zone.allocatedBytes.load(std::memory_order_relaxed);
+            zone.lastFrameAllocations = allocations - zone.frameStartAllocations;
+            zone.lastFrameBytes = bytes - zone.frameStartBytes;
+            zone.frameStartAllocations = allocations;
+            zone.frameStartBytes = bytes;
+        }
+    }
+
+    // Zones that have allocated anything, largest live footprint first
+    static std::vector<ZoneMemory> report() {
+        std::vector<ZoneMemory> result;
+        if (!enabled()) {
+            return result;
+        }
+        std::lock_guard<std::mutex> lock(frameMutex());
+        const auto& zones = counters();
+        for (uint32_t id = 0; id < zones.size(); ++id) {
+            const ZoneCounters& zone = zones[id];
+            const uint64_t allocations = zone.allocations.load(std::memory_order_relaxed);
+            if (allocations == 0) {
+                continue;
+            }
+            result.push_back(ZoneMemory{
+                Profiler::getInstance().zoneName(id),
+                zone.liveBytes.load(std::memory_order_relaxed),
+                zone.peakBytes.load(std::memory_order_relaxed),
+                allocations,
+                zone.lastFrameAllocations,
+                zone.lastFrameBytes
+            });
+        }
+        std::sort(result.begin(), result.end(), [](const ZoneMemory& a, const ZoneMemory& b) {
+            return a.liveBytes > b.liveBytes;
+        });
+        return result;
+    }
+
+    static void printReport() {
+        if (!enabled()) {
+            spdlog::info("Allocation tracking is disabled (build with FORGE_TRACK_ALLOCATIONS)");
+            return;
+        }
+        for (const auto& zone : report()) {
+            spdlog::info("{}: Live: {} KB, Peak: {} KB, Allocs/frame: {}, Bytes/frame: {}, Total allocs: {}",
+                zone.name,
+                zone.liveBytes / 1024,
+                zone.peakBytes / 1024,
+                zone.allocationsPerFrame,
+                zone.bytesPerFrame,
+                zone.totalAllocations);
+        }
+    }
+
+private:
+    struct alignas(64) ZoneCounters {
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> allocatedBytes{0};
+        std::atomic<int64_t> liveBytes{0};
+        std::atomic<int64_t> peakBytes{0};
+        // Guarded by frameMutex
+        uint64_t frameStartAllocations = 0;
+        uint64_t frameStartBytes = 0;
+        uint64_t lastFrameAllocations = 0;
+        uint64_t lastFrameBytes = 0;
+    };
+
+    static uint32_t clampZone(uint32_t zoneId) {
+        return zoneId < Profiler::MaxZones ? zoneId : Profiler::OverflowZoneId;
+    }
+
+    // Constant-initialized, so usable by allocations made before main()
+    static std::array<ZoneCounters, Profiler::MaxZones>& counters() {
+        static std::array<ZoneCounters, Profiler::MaxZones> zones;
+        return zones;
+    }
+
+    static std::mutex& frameMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
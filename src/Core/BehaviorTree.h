@@ -0,0 +1,154 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ForgeEngine {
+namespace Core {
+
+enum class BehaviorStatus {
+    Success,
+    Failure,
+    Running
+};
+
+enum class BehaviorNodeType {
+    Sequence,
+    Selector,
+    Condition,
+    Action,
+    Parallel
+};
+
+// Everything about running a behavior tree that differs per agent: which
+// tree the agent last ran and, for each composite node, the child a Running
+// result left off at. Trees themselves are immutable and shared by every
+// agent, so this is the only state an update writes besides the agent.
+// Plain data; keep one per agent, e.g. as an ECS component.
+struct BehaviorBlackboard {
+    static constexpr size_t MaxComposites = 8;
+
+    const void* tree = nullptr;
+    std::array<uint8_t, MaxComposites> resumeAt{};
+};
+
+template<typename Agent>
+class BehaviorTree;
+
+template<typename Agent>
+class BehaviorNode {
+public:
+    virtual ~BehaviorNode() = default;
+
+    virtual BehaviorStatus execute(Agent& agent, BehaviorBlackboard& blackboard) const = 0;
+    virtual BehaviorNodeType type() const = 0;
+
+private:
+    friend class BehaviorTree<Agent>;
+    template<typename> friend class SequenceNode;
+
+    // Called once by BehaviorTree before the node is shared; composites
+    // claim a blackboard slot here
+    virtual void bind(size_t& nextComposite) { (void)nextComposite; }
+};
+
+// Leaf calling a plain function. Trees are shared between agents, so an
+// action keeps no state of its own; anything it must remember goes in the
+// agent or the blackboard.
+template<typename Agent>
+class ActionNode final : public BehaviorNode<Agent> {
+public:
+    using Function = BehaviorStatus (*)(Agent&, BehaviorBlackboard&);
+
+    explicit ActionNode(Function action) : action(action) {}
+
+    BehaviorStatus execute(Agent& agent, BehaviorBlackboard& blackboard) const override {
+        return action(agent, blackboard);
+    }
+
+    BehaviorNodeType type() const override { return BehaviorNodeType::Action; }
+
+private:
+    Function action;
+};
+
+// Runs children in order until one fails. A Running child is resumed on
+// the agent's next execute() instead of restarting the sequence.
+template<typename Agent>
+class SequenceNode final : public BehaviorNode<Agent> {
+public:
+    SequenceNode& add(std::unique_ptr<BehaviorNode<Agent>> child) {
+        children.push_back(std::move(child));
+        return *this;
+    }
+
+    BehaviorStatus execute(Agent& agent, BehaviorBlackboard& blackboard) const override {
+        uint8_t& resumeAt = blackboard.resumeAt[slot];
+        for (size_t i = resumeAt; i < children.size(); ++i) {
+            const BehaviorStatus status = children[i]->execute(agent, blackboard);
+            if (status == BehaviorStatus::Running) {
+                resumeAt = static_cast<uint8_t>(i);
+                return status;
+            }
+            if (status == BehaviorStatus::Failure) {
+                resumeAt = 0;
+                return status;
+            }
+        }
+        resumeAt = 0;
+        return BehaviorStatus::Success;
+    }
+
+    BehaviorNodeType type() const override { return BehaviorNodeType::Sequence; }
+
+private:
+    void bind(size_t& nextComposite) override {
+        if (nextComposite >= BehaviorBlackboard::MaxComposites || children.size() > UINT8_MAX) {
+            throw std::length_error("BehaviorTree: too many composite nodes or children");
+        }
+        slot = nextComposite++;
+        for (auto& child : children) {
+            child->bind(nextComposite);
+        }
+    }
+
+    std::vector<std::unique_ptr<BehaviorNode<Agent>>> children;
+    size_t slot = 0;
+};
+
+// Immutable tree built once, e.g. per NPC state or archetype, and executed
+// by any number of agents, concurrently if the actions allow it. Executing
+// allocates nothing; per-agent progress lives in the BehaviorBlackboard.
+template<typename Agent>
+class BehaviorTree {
+public:
+    explicit BehaviorTree(std::unique_ptr<BehaviorNode<Agent>> root) {
+        size_t composites = 0;
+        root->bind(composites);
+        this->root = std::move(root);
+    }
+
+    BehaviorTree(const BehaviorTree&) = delete;
+    BehaviorTree& operator=(const BehaviorTree&) = delete;
+
+    BehaviorStatus execute(Agent& agent, BehaviorBlackboard& blackboard) const {
+        // Resume points belong to the tree that recorded them
+        if (blackboard.tree != this) {
+            blackboard = BehaviorBlackboard{};
+            blackboard.tree = this;
+        }
+        return root->execute(agent, blackboard);
+    }
+
+    const BehaviorNode<Agent>& rootNode() const { return *root; }
+
+private:
+    std::unique_ptr<const BehaviorNode<Agent>> root;
+};
+
+} // namespace Core
+} // namespace ForgeEngine
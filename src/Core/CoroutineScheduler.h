@@ -0,0 +1,230 @@
+#pragma once
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <variant>
+#include <vector>
+#include "Task.h"
+#include "TaskGroup.h"
+#include "ThreadPool.h"
+
+namespace ForgeEngine {
+namespace Core {
+
+// Drives Task<T> coroutines on the ThreadPool and the simulation clock.
+// Provides awaitables to hop onto a worker, to wait for the next frame or a
+// number of simulated days, and to wait for several tasks at once, so
+// multi-frame work can be written as straight-line code.
+//
+// advanceFrame() must be called once per simulation tick. Coroutines woken by
+// it run up to their next suspension point before it returns, so they see
+// the world between system updates rather than in the middle of one.
+class CoroutineScheduler {
+public:
+    explicit CoroutineScheduler(std::shared_ptr<ThreadPool> threadPool)
+        : m_threadPool(std::move(threadPool)) {}
+
+    CoroutineScheduler(const CoroutineScheduler&) = delete;
+    CoroutineScheduler& operator=(const CoroutineScheduler&) = delete;
+
+    // co_await schedule(): continue on a ThreadPool worker in the given lane
+    auto schedule(TaskPriority priority = TaskPriority::Normal) {
+        struct ScheduleAwaiter {
+            ThreadPool& pool;
+            TaskPriority priority;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) {
+                pool.post(priority, [handle]() { handle.resume(); });
+            }
+            void await_resume() const noexcept {}
+        };
+        return ScheduleAwaiter{*m_threadPool, priority};
+    }
+
+    // co_await nextFrame(): continue during the next advanceFrame()
+    auto nextFrame() {
+        struct FrameAwaiter {
+            CoroutineScheduler& scheduler;
+            bool await_ready() const noexcept { return false; }
+            void await_suspend(std::coroutine_handle<> handle) {
+                std::lock_guard<std::mutex> lock(scheduler.m_mutex);
+                scheduler.m_frameWaiters.push_back(handle);
+            }
+            void await_resume() const noexcept {}
+        };
+        return FrameAwaiter{*this};
+    }
+
+    // co_await afterDays(n): continue once the simulation clock has advanced
+    // by n days
+    auto afterDays(float days) {
+        struct DelayAwaiter {
+            CoroutineScheduler& scheduler;
+            float days;
+            bool await_ready() const noexcept { return days <= 0.0f; }
+            void await_suspend(std::coroutine_handle<> handle) {
+                std::lock_guard<std::mutex> lock(scheduler.m_mutex);
+                scheduler.m_timers.push(Timer{
+                    scheduler.m_simulationTime + days,
+                    scheduler.m_nextTimerId++,
+                    handle
+                });
+            }
+            void await_resume() const noexcept {}
+        };
+        return DelayAwaiter{*this, days};
+    }
+
+    // Runs all tasks concurrently on the pool and resumes once every one has
+    // finished. Results keep the order of the input; the first exception is
+    // rethrown after all tasks are done.
+    template<typename T>
+        requires (!std::is_void_v<T>)
+    Task<std::vector<T>> whenAll(std::vector<Task<T>> tasks) {
+        std::vector<std::optional<T>> slots(tasks.size());
+        WhenAllLatch latch(tasks.size());
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            runWhenAllChild(std::move(tasks[i]), latch, slots[i]);
+        }
+        co_await latch;
+
+        std::vector<T> results;
+        results.reserve(slots.size());
+        for (auto& slot : slots) {
+            results.push_back(std::move(*slot));
+        }
+        co_return results;
+    }
+
+    Task<void> whenAll(std::vector<Task<void>> tasks) {
+        std::optional<std::monostate> unused;
+        WhenAllLatch latch(tasks.size());
+        for (auto& task : tasks) {
+            runWhenAllChild(std::move(task), latch, unused);
+        }
+        co_await latch;
+    }
+
+    // Starts a task on the pool and lets it run to completion on its own.
+    // Exceptions escaping it are logged.
+    template<typename T>
+    void spawn(Task<T> task) {
+        runDetached(std::move(task));
+    }
+
+    // Advances the simulation clock and resumes every coroutine waiting for
+    // this frame or for a time that has now passed.
+    void advanceFrame(float deltaDays) {
+        std::vector<std::coroutine_handle<>> ready;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_simulationTime += deltaDays;
+            ready.swap(m_frameWaiters);
+            while (!m_timers.empty() && m_timers.top().wakeTime <= m_simulationTime) {
+                ready.push_back(m_timers.top().handle);
+                m_timers.pop();
+            }
+        }
+
+        if (ready.empty()) {
+            return;
+        }
+
+        TaskGroup slices(*m_threadPool);
+        for (auto handle : ready) {
+            slices.run([handle]() { handle.resume(); });
+        }
+        slices.wait();
+    }
+
+    float simulationTime() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_simulationTime;
+    }
+
+private:
+    struct Timer {
+        float wakeTime;
+        uint64_t id;   // FIFO among timers that wake on the same tick
+        std::coroutine_handle<> handle;
+
+        bool operator>(const Timer& other) const {
+            return wakeTime != other.wakeTime ? wakeTime > other.wakeTime : id > other.id;
+        }
+    };
+
+    // Counts finished whenAll children; the awaiting coroutine holds one
+    // extra count so it cannot be resumed before it has suspended
+    struct WhenAllLatch {
+        explicit WhenAllLatch(size_t count) : remaining(count + 1) {}
+
+        std::atomic<size_t> remaining;
+        std::coroutine_handle<> waiter;
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+
+        void fail(std::exception_ptr exception) {
+            if (!failed.exchange(true)) {
+                error = exception;
+            }
+        }
+
+        void arrive() {
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                waiter.resume();
+            }
+        }
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+            waiter = handle;
+            return remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+        }
+
+        void await_resume() {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    };
+
+    std::shared_ptr<ThreadPool> m_threadPool;
+
+    mutable std::mutex m_mutex;
+    float m_simulationTime = 0.0f;
+    uint64_t m_nextTimerId = 0;
+    std::vector<std::coroutine_handle<>> m_frameWaiters;
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> m_timers;
+
+    template<typename T>
+    DetachedTask runDetached(Task<T> task) {
+        co_await schedule();
+        co_await task;
+    }
+
+    template<typename T, typename Slot>
+    DetachedTask runWhenAllChild(Task<T> task, WhenAllLatch& latch, Slot& slot) {
+        co_await schedule();
+        try {
+            if constexpr (std::is_void_v<T>) {
+                co_await task;
+            } else {
+                slot.emplace(co_await task);
+            }
+        } catch (...) {
+            latch.fail(std::current_exception());
+        }
+        // Last touch of the latch and slot; the waiter may resume here
+        latch.arrive();
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -0,0 +1,676 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "TaskFunction.h"
+#include "ThreadPool.h"
+
+namespace ForgeEngine {
+namespace Core {
+
+// Archetype ECS. Entities with the same set of component types share an
+// archetype, which stores each component type as its own column inside
+// fixed-size chunks, so a query walks only the columns it asks for, packed.
+//
+// Adding or removing a component moves the entity to another archetype.
+// Structural changes (create, destroy, add, remove) are not allowed while a
+// query is iterating; record them in a CommandBuffer and play it back after.
+// A World is not thread-safe, except that queries may run several
+// forEach/parallelForEach passes that only touch their own entities.
+
+// Generational entity id; a destroyed entity's id goes stale
+struct Entity {
+    static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+
+    explicit operator bool() const { return index != InvalidIndex; }
+    bool operator==(const Entity&) const = default;
+};
+
+using ComponentId = uint32_t;
+
+// Type-erased lifecycle of one component type
+struct ComponentInfo {
+    ComponentId id;
+    size_t size;
+    size_t alignment;
+    void (*relocate)(void* dst, void* src);   // move-construct dst, destroy src
+    void (*destroy)(void* object);
+};
+
+namespace detail {
+
+inline ComponentId nextComponentId() {
+    static std::atomic<ComponentId> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+template<typename T>
+const ComponentInfo& componentInfo() {
+    static_assert(std::is_move_constructible_v<T>,
+                  "ECS components are relocated between chunks and must be movable");
+    static const ComponentInfo info{
+        nextComponentId(),
+        sizeof(T),
+        alignof(T),
+        [](void* dst, void* src) {
+            T* from = std::launder(static_cast<T*>(src));
+            ::new (dst) T(std::move(*from));
+            from->~T();
+        },
+        [](void* object) { std::launder(static_cast<T*>(object))->~T(); }
+    };
+    return info;
+}
+
+} // namespace detail
+
+template<typename T>
+const ComponentInfo& componentInfo() {
+    return detail::componentInfo<std::remove_cvref_t<T>>();
+}
+
+template<typename T>
+ComponentId componentId() {
+    return componentInfo<T>().id;
+}
+
+// All entities with one exact set of component types. Rows are dense: row r
+// lives in chunk r / chunkCapacity, and removing a row moves the last one
+// into its place.
+class Archetype {
+public:
+    static constexpr size_t ChunkBytes = 16 * 1024;
+
+    struct Column {
+        const ComponentInfo* info;
+        size_t offset;      // of the column within each chunk
+    };
+
+    // columnInfos must be sorted by id
+    explicit Archetype(std::vector<const ComponentInfo*> columnInfos) {
+        size_t rowBytes = sizeof(Entity);
+        for (const ComponentInfo* info : columnInfos) {
+            rowBytes += info->size;
+        }
+        m_chunkCapacity = std::max<size_t>(1, ChunkBytes / rowBytes);
+
+        // Entities first, then each column aligned for its type
+        size_t offset = sizeof(Entity) * m_chunkCapacity;
+        for (const ComponentInfo* info : columnInfos) {
+            offset = (offset + info->alignment - 1) / info->alignment * info->alignment;
+            m_columns.push_back(Column{info, offset});
+            m_signature.push_back(info->id);
+            offset += info->size * m_chunkCapacity;
+        }
+        m_chunkBytes = offset;
+    }
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    ~Archetype() {
+        for (size_t row = 0; row < m_size; ++row) {
+            for (size_t c = 0; c < m_columns.size(); ++c) {
+                m_columns[c].info->destroy(component(c, row));
+            }
+        }
+        for (std::byte* chunk : m_chunks) {
+            ::operator delete(chunk, std::align_val_t{ChunkAlignment});
+        }
+    }
+
+    const std::vector<ComponentId>& signature() const { return m_signature; }
+    const std::vector<Column>& columns() const { return m_columns; }
+
+    // Column holding the component, or -1
+    int columnIndex(ComponentId id) const {
+        auto it = std::lower_bound(m_signature.begin(), m_signature.end(), id);
+        return it != m_signature.end() && *it == id ? static_cast<int>(it - m_signature.begin()) : -1;
+    }
+
+    size_t size() const { return m_size; }
+    size_t chunkCapacity() const { return m_chunkCapacity; }
+    size_t chunkCount() const { return (m_size + m_chunkCapacity - 1) / m_chunkCapacity; }
+
+    size_t chunkSize(size_t chunk) const {
+        return std::min(m_chunkCapacity, m_size - chunk * m_chunkCapacity);
+    }
+
+    void* columnData(size_t column, size_t chunk) {
+        return m_chunks[chunk] + m_columns[column].offset;
+    }
+
+    Entity* chunkEntities(size_t chunk) {
+        return std::launder(reinterpret_cast<Entity*>(m_chunks[chunk]));
+    }
+
+    void* component(size_t column, size_t row) {
+        return m_chunks[row / m_chunkCapacity] + m_columns[column].offset +
+               row % m_chunkCapacity * m_columns[column].info->size;
+    }
+
+    Entity& entityAt(size_t row) {
+        return chunkEntities(row / m_chunkCapacity)[row % m_chunkCapacity];
+    }
+
+    // Appends a row whose component slots are raw memory
+    size_t pushRow(Entity entity) {
+        if (m_size == m_chunks.size() * m_chunkCapacity) {
+            m_chunks.push_back(static_cast<std::byte*>(
+                ::operator new(m_chunkBytes, std::align_val_t{ChunkAlignment})));
+        }
+        const size_t row = m_size++;
+        ::new (static_cast<void*>(&entityAt(row))) Entity(entity);
+        return row;
+    }
+
+    // Removes a row whose components have already been destroyed or moved
+    // out. Returns the entity moved into the row, or an invalid one.
+    Entity eraseRow(size_t row) {
+        const size_t last = --m_size;
+        if (row == last) {
+            return {};
+        }
+        for (size_t c = 0; c < m_columns.size(); ++c) {
+            m_columns[c].info->relocate(component(c, row), component(c, last));
+        }
+        entityAt(row) = entityAt(last);
+        return entityAt(row);
+    }
+
+    // Cached transitions to the archetype with one component more or less
+    std::unordered_map<ComponentId, Archetype*> addEdges;
+    std::unordered_map<ComponentId, Archetype*> removeEdges;
+
+private:
+    static constexpr size_t ChunkAlignment = 64;
+
+    std::vector<Column> m_columns;
+    std::vector<ComponentId> m_signature;
+    std::vector<std::byte*> m_chunks;
+    size_t m_chunkCapacity = 0;
+    size_t m_chunkBytes = 0;
+    size_t m_size = 0;
+};
+
+class World;
+
+class QueryBase {
+public:
+    virtual ~QueryBase() = default;
+};
+
+// Cached match of every archetype that has all of Ts. Archetypes created
+// after the query are picked up incrementally on the next pass. Ts may be
+// const-qualified to document read-only access.
+template<typename... Ts>
+class Query : public QueryBase {
+public:
+    explicit Query(World& world) : m_world(&world) {}
+
+    // f(Ts&...) or f(Entity, Ts&...) for every matching entity
+    template<typename F>
+    void forEach(F&& f);
+
+    // f(count, Ts*...) or f(count, const Entity*, Ts*...) once per chunk, for
+    // loops that want the raw columns
+    template<typename F>
+    void forEachChunk(F&& f);
+
+    // forEach with chunks spread over the pool; f must only touch the
+    // components it is given
+    template<typename F>
+    void parallelForEach(ThreadPool& pool, F&& f);
+
+    size_t size();
+
+private:
+    struct Match {
+        Archetype* archetype;
+        std::array<size_t, sizeof...(Ts)> columns;
+    };
+
+    World* m_world;
+    std::vector<Match> m_matches;
+    size_t m_archetypesSeen = 0;
+
+    void refresh();
+
+    template<typename F>
+    void visitChunk(const Match& match, size_t chunk, F& f);
+};
+
+class World {
+public:
+    World() = default;
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    ~World() {
+        // Queries hold archetype pointers; archetypes destroy their rows
+        m_queries.clear();
+        m_archetypes.clear();
+    }
+
+    // Components are taken by value and moved into place
+    template<typename... Ts>
+    Entity create(Ts... components) {
+        static_assert(distinct<Ts...>(), "Component types must be distinct");
+        checkNotIterating();
+        Archetype& archetype = archetypeFor({&componentInfo<Ts>()...});
+        const Entity entity = allocateEntity();
+        const size_t row = archetype.pushRow(entity);
+        (constructIn(archetype, row, std::move(components)), ...);
+        m_records[entity.index].archetype = &archetype;
+        m_records[entity.index].row = static_cast<uint32_t>(row);
+        return entity;
+    }
+
+    // False if the entity was already destroyed
+    bool destroy(Entity entity) {
+        checkNotIterating();
+        if (!alive(entity)) {
+            return false;
+        }
+        Record& record = m_records[entity.index];
+        Archetype& archetype = *record.archetype;
+        for (size_t c = 0; c < archetype.columns().size(); ++c) {
+            archetype.columns()[c].info->destroy(archetype.component(c, record.row));
+        }
+        fixMoved(archetype.eraseRow(record.row), record.row);
+
+        ++record.generation;
+        record.archetype = nullptr;
+        record.nextFree = m_freeHead;
+        m_freeHead = entity.index;
+        --m_size;
+        return true;
+    }
+
+    bool alive(Entity entity) const {
+        return entity.index < m_records.size() &&
+               m_records[entity.index].generation == entity.generation &&
+               m_records[entity.index].archetype != nullptr;
+    }
+
+    // nullptr if the entity is dead or lacks the component
+    template<typename T>
+    T* get(Entity entity) {
+        if (!alive(entity)) {
+            return nullptr;
+        }
+        const Record& record = m_records[entity.index];
+        const int column = record.archetype->columnIndex(componentId<T>());
+        if (column < 0) {
+            return nullptr;
+        }
+        return std::launder(static_cast<T*>(record.archetype->component(column, record.row)));
+    }
+
+    template<typename T>
+    const T* get(Entity entity) const {
+        return const_cast<World*>(this)->get<T>(entity);
+    }
+
+    template<typename T>
+    bool has(Entity entity) const {
+        return alive(entity) &&
+               m_records[entity.index].archetype->columnIndex(componentId<T>()) >= 0;
+    }
+
+    // Adds the component, or replaces it if the entity already has one
+    template<typename T, typename... Args>
+    T& add(Entity entity, Args&&... args) {
+        if (T* existing = get<T>(entity)) {
+            *existing = T(std::forward<Args>(args)...);
+            return *existing;
+        }
+        checkNotIterating();
+        if (!alive(entity)) {
+            throw std::runtime_error("Adding a component to a dead entity");
+        }
+        T component(std::forward<Args>(args)...);
+        Record& record = m_records[entity.index];
+        Archetype& source = *record.archetype;
+        const ComponentInfo& info = componentInfo<T>();
+        Archetype* target = source.addEdges[info.id];
+        if (!target) {
+            std::vector<const ComponentInfo*> infos;
+            for (const auto& column : source.columns()) {
+                infos.push_back(column.info);
+            }
+            infos.push_back(&info);
+            target = &archetypeFor(std::move(infos));
+            source.addEdges[info.id] = target;
+        }
+
+        const size_t row = moveEntity(entity, source, *target);
+        void* slot = target->component(target->columnIndex(info.id), row);
+        return *::new (slot) T(std::move(component));
+    }
+
+    // False if the entity is dead or had no such component
+    template<typename T>
+    bool remove(Entity entity) {
+        if (!has<T>(entity)) {
+            return false;
+        }
+        checkNotIterating();
+        Record& record = m_records[entity.index];
+        Archetype& source = *record.archetype;
+        const ComponentInfo& info = componentInfo<T>();
+        Archetype* target = source.removeEdges[info.id];
+        if (!target) {
+            std::vector<const ComponentInfo*> infos;
+            for (const auto& column : source.columns()) {
+                if (column.info != &info) {
+                    infos.push_back(column.info);
+                }
+            }
+            target = &archetypeFor(std::move(infos));
+            source.removeEdges[info.id] = target;
+        }
+        moveEntity(entity, source, *target);
+        return true;
+    }
+
+    // The cached query for Ts; cheap to call every frame
+    template<typename... Ts>
+    Query<Ts...>& query() {
+        auto& slot = m_queries[std::type_index(typeid(Query<Ts...>))];
+        if (!slot) {
+            slot = std::make_unique<Query<Ts...>>(*this);
+        }
+        return static_cast<Query<Ts...>&>(*slot);
+    }
+
+    size_t size() const { return m_size; }
+    size_t archetypeCount() const { return m_archetypes.size(); }
+
+private:
+    template<typename... Ts>
+    friend class Query;
+
+    struct Record {
+        Archetype* archetype = nullptr;
+        uint32_t row = 0;
+        uint32_t generation = 0;
+        uint32_t nextFree = Entity::InvalidIndex;
+    };
+
+    std::vector<Record> m_records;
+    uint32_t m_freeHead = Entity::InvalidIndex;
+    size_t m_size = 0;
+    std::vector<std::unique_ptr<Archetype>> m_archetypes;
+    std::map<std::vector<ComponentId>, Archetype*> m_archetypeIndex;
+    std::unordered_map<std::type_index, std::unique_ptr<QueryBase>> m_queries;
+    std::atomic<int> m_iterating{0};
+
+    template<typename... Ts>
+    static constexpr bool distinct() {
+        if constexpr (sizeof...(Ts) < 2) {
+            return true;
+        } else {
+            return distinctFirst<Ts...>();
+        }
+    }
+
+    template<typename T, typename... Rest>
+    static constexpr bool distinctFirst() {
+        return (!std::is_same_v<T, Rest> && ...) && distinct<Rest...>();
+    }
+
+    void checkNotIterating() const {
+        if (m_iterating.load(std::memory_order_relaxed) > 0) {
+            throw std::logic_error("Structural ECS change during a query; use a CommandBuffer");
+        }
+    }
+
+    Archetype& archetypeFor(std::vector<const ComponentInfo*> infos) {
+        std::sort(infos.begin(), infos.end(),
+                  [](const ComponentInfo* a, const ComponentInfo* b) { return a->id < b->id; });
+        std::vector<ComponentId> signature;
+        for (const ComponentInfo* info : infos) {
+            signature.push_back(info->id);
+        }
+        auto it = m_archetypeIndex.find(signature);
+        if (it != m_archetypeIndex.end()) {
+            return *it->second;
+        }
+        m_archetypes.push_back(std::make_unique<Archetype>(std::move(infos)));
+        Archetype* archetype = m_archetypes.back().get();
+        m_archetypeIndex.emplace(std::move(signature), archetype);
+        return *archetype;
+    }
+
+    Entity allocateEntity() {
+        uint32_t index;
+        if (m_freeHead != Entity::InvalidIndex) {
+            index = m_freeHead;
+            m_freeHead = m_records[index].nextFree;
+        } else {
+            if (m_records.size() == Entity::InvalidIndex) {
+                throw std::runtime_error("World is full");
+            }
+            index = static_cast<uint32_t>(m_records.size());
+            m_records.emplace_back();
+        }
+        ++m_size;
+        return Entity{index, m_records[index].generation};
+    }
+
+    template<typename T>
+    void constructIn(Archetype& archetype, size_t row, T&& value) {
+        using Component = std::remove_cvref_t<T>;
+        void* slot = archetype.component(archetype.columnIndex(componentId<Component>()), row);
+        ::new (slot) Component(std::move(value));
+    }
+
+    // Moves the shared components to a new row in target and destroys the
+    // rest; components target has and source lacks are left raw
+    size_t moveEntity(Entity entity, Archetype& source, Archetype& target) {
+        Record& record = m_records[entity.index];
+        const size_t sourceRow = record.row;
+        const size_t row = target.pushRow(entity);
+        for (size_t c = 0; c < source.columns().size(); ++c) {
+            const ComponentInfo* info = source.columns()[c].info;
+            const int targetColumn = target.columnIndex(info->id);
+            if (targetColumn >= 0) {
+                info->relocate(target.component(targetColumn, row), source.component(c, sourceRow));
+            } else {
+                info->destroy(source.component(c, sourceRow));
+            }
+        }
+        fixMoved(source.eraseRow(sourceRow), sourceRow);
+        record.archetype = &target;
+        record.row = static_cast<uint32_t>(row);
+        return row;
+    }
+
+    void fixMoved(Entity moved, size_t row) {
+        if (moved) {
+            m_records[moved.index].row = static_cast<uint32_t>(row);
+        }
+    }
+};
+
+// Records structural changes for later, so systems can create and destroy
+// entities from inside a query. Commands apply in recording order when
+// playback() runs; commands on entities that have died since are skipped.
+// One buffer per thread.
+class CommandBuffer {
+public:
+    explicit CommandBuffer(World& world) : m_world(&world) {}
+
+    template<typename... Ts>
+    void create(Ts... components) {
+        m_commands.emplace_back([world = m_world, values = std::make_tuple(std::move(components)...)]() mutable {
+            std::apply([world](auto&... value) { world->create(std::move(value)...); }, values);
+        });
+    }
+
+    void destroy(Entity entity) {
+        m_commands.emplace_back([world = m_world, entity] { world->destroy(entity); });
+    }
+
+    template<typename T>
+    void add(Entity entity, T component) {
+        m_commands.emplace_back([world = m_world, entity, value = std::move(component)]() mutable {
+            if (world->alive(entity)) {
+                world->add<T>(entity, std::move(value));
+            }
+        });
+    }
+
+    template<typename T>
+    void remove(Entity entity) {
+        m_commands.emplace_back([world = m_world, entity] { world->remove<T>(entity); });
+    }
+
+    void playback() {
+        // Commands may record more commands; take the batch first
+        std::vector<TaskFunction> commands = std::move(m_commands);
+        m_commands.clear();
+        for (TaskFunction& command : commands) {
+            command();
+        }
+    }
+
+    size_t size() const { return m_commands.size(); }
+    bool empty() const { return m_commands.empty(); }
+
+private:
+    World* m_world;
+    std::vector<TaskFunction> m_commands;
+};
+
+template<typename... Ts>
+void Query<Ts...>::refresh() {
+    auto& archetypes = m_world->m_archetypes;
+    for (; m_archetypesSeen < archetypes.size(); ++m_archetypesSeen) {
+        Archetype* archetype = archetypes[m_archetypesSeen].get();
+        const std::array<int, sizeof...(Ts)> columns{archetype->columnIndex(componentId<Ts>())...};
+        if (std::all_of(columns.begin(), columns.end(), [](int c) { return c >= 0; })) {
+            Match match{archetype, {}};
+            std::copy(columns.begin(), columns.end(), match.columns.begin());
+            m_matches.push_back(match);
+        }
+    }
+}
+
+template<typename... Ts>
+template<typename F>
+void Query<Ts...>::visitChunk(const Match& match, size_t chunk, F& f) {
+    Archetype& archetype = *match.archetype;
+    const size_t count = archetype.chunkSize(chunk);
+    Entity* entities = archetype.chunkEntities(chunk);
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        std::tuple<std::remove_reference_t<Ts>*...> columns{
+            std::launder(static_cast<std::remove_cvref_t<Ts>*>(archetype.columnData(match.columns[I], chunk)))...};
+        for (size_t row = 0; row < count; ++row) {
+            if constexpr (std::is_invocable_v<F&, Entity, Ts&...>) {
+                f(entities[row], std::get<I>(columns)[row]...);
+            } else {
+                f(std::get<I>(columns)[row]...);
+            }
+        }
+    }(std::index_sequence_for<Ts...>{});
+}
+
+template<typename... Ts>
+template<typename F>
+void Query<Ts...>::forEach(F&& f) {
+    refresh();
+    ++m_world->m_iterating;
+    try {
+        for (const Match& match : m_matches) {
+            for (size_t chunk = 0; chunk < match.archetype->chunkCount(); ++chunk) {
+                visitChunk(match, chunk, f);
+            }
+        }
+    } catch (...) {
+        --m_world->m_iterating;
+        throw;
+    }
+    --m_world->m_iterating;
+}
+
+template<typename... Ts>
+template<typename F>
+void Query<Ts...>::forEachChunk(F&& f) {
+    refresh();
+    ++m_world->m_iterating;
+    try {
+        for (const Match& match : m_matches) {
+            Archetype& archetype = *match.archetype;
+            for (size_t chunk = 0; chunk < archetype.chunkCount(); ++chunk) {
+                [&]<size_t... I>(std::index_sequence<I...>) {
+                    const size_t count = archetype.chunkSize(chunk);
+                    if constexpr (std::is_invocable_v<F&, size_t, const Entity*, std::remove_reference_t<Ts>*...>) {
+                        f(count, static_cast<const Entity*>(archetype.chunkEntities(chunk)),
+                          std::launder(static_cast<std::remove_cvref_t<Ts>*>(
+                              archetype.columnData(match.columns[I], chunk)))...);
+                    } else {
+                        f(count, std::launder(static_cast<std::remove_cvref_t<Ts>*>(
+                              archetype.columnData(match.columns[I], chunk)))...);
+                    }
+                }(std::index_sequence_for<Ts...>{});
+            }
+        }
+    } catch (...) {
+        --m_world->m_iterating;
+        throw;
+    }
+    --m_world->m_iterating;
+}
+
+template<typename... Ts>
+template<typename F>
+void Query<Ts...>::parallelForEach(ThreadPool& pool, F&& f) {
+    refresh();
+    std::vector<std::pair<const Match*, size_t>> chunks;
+    for (const Match& match : m_matches) {
+        for (size_t chunk = 0; chunk < match.archetype->chunkCount(); ++chunk) {
+            chunks.emplace_back(&match, chunk);
+        }
+    }
+    ++m_world->m_iterating;
+    try {
+        pool.parallelFor(size_t{0}, chunks.size(), 1, [&](size_t i) {
+            visitChunk(*chunks[i].first, chunks[i].second, f);
+        });
+    } catch (...) {
+        --m_world->m_iterating;
+        throw;
+    }
+    --m_world->m_iterating;
+}
+
+template<typename... Ts>
+size_t Query<Ts...>::size() {
+    refresh();
+    size_t total = 0;
+    for (const Match& match : m_matches) {
+        total += match.archetype->size();
+    }
+    return total;
+}
+
+} // namespace Core
+} // namespace ForgeEngine
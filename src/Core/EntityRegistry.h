@@ -0,0 +1,95 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ForgeEngine {
+namespace Core {
+
+// Global identity of a simulated character, dense from zero. Unlike an ECS
+// Entity it is never reused, so relationships keyed by a dead character's ID
+// can never attach to a newborn.
+using EntityId = uint32_t;
+inline constexpr EntityId InvalidEntityId = std::numeric_limits<EntityId>::max();
+
+// Name <-> EntityId registry. Hot paths key everything by ID; names are only
+// for display, saves and lookups from scripts. Names need not be unique:
+// find() returns the entity that most recently registered a name, while that
+// entity is alive.
+//
+// Thread-safe. A released ID keeps an empty string in the table, 32 bytes per
+// character that ever lived.
+class EntityRegistry {
+public:
+    EntityRegistry() = default;
+    EntityRegistry(const EntityRegistry&) = delete;
+    EntityRegistry& operator=(const EntityRegistry&) = delete;
+
+    static EntityRegistry& global() {
+        static EntityRegistry registry;
+        return registry;
+    }
+
+    EntityId acquire(std::string_view name) {
+        std::unique_lock lock(mutex);
+        if (names.size() >= InvalidEntityId) {
+            throw std::overflow_error("EntityRegistry: entity IDs exhausted");
+        }
+        const auto id = static_cast<EntityId>(names.size());
+        // deque elements never move, so the views in byName stay valid
+        const std::string& stored = names.emplace_back(name);
+        // Re-key rather than assign: the old key views the older entity's name
+        byName.erase(stored);
+        byName.emplace(stored, id);
+        ++live;
+        return id;
+    }
+
+    // Each acquired ID must be released exactly once
+    void release(EntityId id) {
+        std::unique_lock lock(mutex);
+        if (id >= names.size()) {
+            return;
+        }
+        std::string& name = names[id];
+        auto it = byName.find(name);
+        if (it != byName.end() && it->second == id) {
+            byName.erase(it);
+        }
+        std::string().swap(name);
+        --live;
+    }
+
+    EntityId find(std::string_view name) const {
+        std::shared_lock lock(mutex);
+        auto it = byName.find(name);
+        return it != byName.end() ? it->second : InvalidEntityId;
+    }
+
+    // Empty for released or unknown IDs
+    std::string name(EntityId id) const {
+        std::shared_lock lock(mutex);
+        return id < names.size() ? names[id] : std::string();
+    }
+
+    size_t size() const {
+        std::shared_lock lock(mutex);
+        return live;
+    }
+
+private:
+    std::deque<std::string> names;      // indexed by EntityId
+    std::unordered_map<std::string_view, EntityId> byName;
+    size_t live = 0;
+    mutable std::shared_mutex mutex;
+};
+
+} // namespace Core
+} // namespace ForgeEngine
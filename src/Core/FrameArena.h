@@ -0,0 +1,145 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+namespace ForgeEngine {
+namespace Core {
+
+// Bump allocator for data that lives no longer than the current frame, such
+// as the vectors hot getters return. Allocation is a pointer increment and
+// deallocation does nothing; reset() rewinds the whole arena at once.
+//
+// Each thread has its own arena, reached through local(). endFrame() does not
+// touch other threads' arenas: it advances a frame counter, and each arena
+// rewinds itself the next time its thread calls local(). Nothing allocated
+// from an arena may be kept past endFrame(), including across co_await.
+//
+// After a reset the arena merges its blocks into one large enough for the
+// previous frame, so a steady-state frame allocates nothing from the heap.
+class FrameArena final : public std::pmr::memory_resource {
+public:
+    static constexpr size_t DefaultBlockSize = 64 * 1024;
+
+    explicit FrameArena(size_t blockSize = DefaultBlockSize)
+        : blockSize(blockSize) {}
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    ~FrameArena() override {
+        releaseBlocks();
+    }
+
+    // The calling thread's arena, rewound if a frame has ended since it was
+    // last used
+    static FrameArena& local() {
+        thread_local FrameArena arena;
+        const uint64_t frame = frameCounter().load(std::memory_order_acquire);
+        if (arena.frame != frame) {
+            arena.reset();
+            arena.frame = frame;
+        }
+        return arena;
+    }
+
+    // Invalidates everything allocated from any thread's arena this frame;
+    // call once per frame, after all frame work has joined
+    static void endFrame() {
+        frameCounter().fetch_add(1, std::memory_order_release);
+    }
+
+    // Rewinds to empty. Memory handed out before the reset must not be used.
+    void reset() {
+        if (blocks.size() > 1) {
+            size_t total = 0;
+            for (const Block& block : blocks) {
+                total += block.size;
+            }
+            releaseBlocks();
+            addBlock(total);
+        }
+        current = 0;
+        offset = 0;
+        used = 0;
+    }
+
+    size_t bytesUsed() const { return used; }
+
+    size_t capacity() const {
+        size_t total = 0;
+        for (const Block& block : blocks) {
+            total += block.size;
+        }
+        return total;
+    }
+
+private:
+    struct Block {
+        std::byte* data;
+        size_t size;
+    };
+
+    std::vector<Block> blocks;
+    size_t current = 0;     // block being bumped
+    size_t offset = 0;      // first free byte in that block
+    size_t used = 0;
+    size_t blockSize;
+    uint64_t frame = 0;
+
+    static std::atomic<uint64_t>& frameCounter() {
+        static std::atomic<uint64_t> counter{0};
+        return counter;
+    }
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        while (current < blocks.size()) {
+            if (void* p = bumpIn(blocks[current], bytes, alignment)) {
+                return p;
+            }
+            ++current;
+            offset = 0;
+        }
+        addBlock(std::max(blockSize, bytes + alignment));
+        current = blocks.size() - 1;
+        offset = 0;
+        return bumpIn(blocks[current], bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    void* bumpIn(const Block& block, size_t bytes, size_t alignment) {
+        const auto base = reinterpret_cast<uintptr_t>(block.data);
+        const uintptr_t aligned = (base + offset + alignment - 1) & ~(uintptr_t(alignment) - 1);
+        const size_t end = static_cast<size_t>(aligned - base) + bytes;
+        if (end > block.size) {
+            return nullptr;
+        }
+        used += end - offset;
+        offset = end;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void addBlock(size_t size) {
+        blocks.reserve(blocks.size() + 1);
+        blocks.push_back(Block{static_cast<std::byte*>(::operator new(size)), size});
+    }
+
+    void releaseBlocks() {
+        for (const Block& block : blocks) {
+            ::operator delete(block.data);
+        }
+        blocks.clear();
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -0,0 +1,165 @@
+#pragma once
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace ForgeEngine {
+namespace Core {
+
+// Open-addressing hash map from 32-bit IDs to values, for the small per-NPC
+// maps looked up every tick. Keys and values share one flat slot array with
+// linear probing, so a lookup is a multiply and usually a single cache line;
+// erase() shifts later entries back instead of leaving tombstones.
+//
+// The key EmptyKey is reserved. Inserting may move every value; do not keep
+// pointers across operator[].
+template<typename V>
+class IdMap {
+public:
+    static constexpr uint32_t EmptyKey = std::numeric_limits<uint32_t>::max();
+
+    V* find(uint32_t key) {
+        if (count == 0) {
+            return nullptr;
+        }
+        for (size_t i = bucket(key);; i = next(i)) {
+            if (slots[i].key == key) {
+                return &slots[i].value;
+            }
+            if (slots[i].key == EmptyKey) {
+                return nullptr;
+            }
+        }
+    }
+
+    const V* find(uint32_t key) const {
+        return const_cast<IdMap*>(this)->find(key);
+    }
+
+    bool contains(uint32_t key) const { return find(key) != nullptr; }
+
+    // Value for key, value-initialized if it was absent
+    V& operator[](uint32_t key) {
+        assert(key != EmptyKey);
+        if ((count + 1) * 4 > slots.size() * 3) {
+            rehash(slots.empty() ? MinCapacity : slots.size() * 2);
+        }
+        size_t i = bucket(key);
+        for (; slots[i].key != EmptyKey; i = next(i)) {
+            if (slots[i].key == key) {
+                return slots[i].value;
+            }
+        }
+        slots[i].key = key;
+        slots[i].value = V{};
+        ++count;
+        return slots[i].value;
+    }
+
+    bool erase(uint32_t key) {
+        if (count == 0) {
+            return false;
+        }
+        size_t hole = bucket(key);
+        for (; slots[hole].key != key; hole = next(hole)) {
+            if (slots[hole].key == EmptyKey) {
+                return false;
+            }
+        }
+        // Pull back every later entry of the run whose home is not between
+        // the hole and its current slot
+        for (size_t i = next(hole); slots[i].key != EmptyKey; i = next(i)) {
+            const size_t home = bucket(slots[i].key);
+            const bool stays = hole < i ? (home > hole && home <= i) : (home > hole || home <= i);
+            if (!stays) {
+                slots[hole] = std::move(slots[i]);
+                hole = i;
+            }
+        }
+        slots[hole].key = EmptyKey;
+        slots[hole].value = V{};
+        --count;
+        return true;
+    }
+
+    // Calls fn(key, value) for every entry, in no particular order
+    template<typename F>
+    void forEach(F&& fn) {
+        for (Slot& slot : slots) {
+            if (slot.key != EmptyKey) {
+                fn(slot.key, slot.value);
+            }
+        }
+    }
+
+    template<typename F>
+    void forEach(F&& fn) const {
+        for (const Slot& slot : slots) {
+            if (slot.key != EmptyKey) {
+                fn(slot.key, slot.value);
+            }
+        }
+    }
+
+    void reserve(size_t n) {
+        size_t capacity = MinCapacity;
+        while (n * 4 > capacity * 3) {
+            capacity *= 2;
+        }
+        if (capacity > slots.size()) {
+            rehash(capacity);
+        }
+    }
+
+    void clear() {
+        slots.clear();
+        count = 0;
+        shift = 64;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return slots.size(); }
+
+private:
+    static constexpr size_t MinCapacity = 8;
+
+    struct Slot {
+        uint32_t key = EmptyKey;
+        V value{};
+    };
+
+    std::vector<Slot> slots;    // power-of-two size
+    size_t count = 0;
+    unsigned shift = 64;        // 64 - log2(slots.size())
+
+    // Fibonacci hashing: sequential IDs spread across the table
+    size_t bucket(uint32_t key) const {
+        return static_cast<size_t>((uint64_t(key) * 0x9E3779B97F4A7C15ull) >> shift);
+    }
+
+    size_t next(size_t i) const { return (i + 1) & (slots.size() - 1); }
+
+    void rehash(size_t capacity) {
+        std::vector<Slot> old = std::exchange(slots, std::vector<Slot>(capacity));
+        shift = 64;
+        for (size_t c = capacity; c > 1; c >>= 1) {
+            --shift;
+        }
+        for (Slot& slot : old) {
+            if (slot.key != EmptyKey) {
+                size_t i = bucket(slot.key);
+                while (slots[i].key != EmptyKey) {
+                    i = next(i);
+                }
+                slots[i] = std::move(slot);
+            }
+        }
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -0,0 +1,114 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ForgeEngine {
+namespace Core {
+
+// HDR-style histogram of durations in nanoseconds. Values below 64 ns are
+// counted exactly; above that every power of two is split into 64 linear
+// sub-buckets, so any recorded value is within ~1.6% of its bucket bounds.
+// Memory is fixed (about 18 KB once used) regardless of how many values are
+// recorded. Values above MaxValue are counted in the last bucket.
+class LatencyHistogram {
+public:
+    static constexpr int SubBucketBits = 6;
+    static constexpr int64_t SubBucketCount = int64_t{1} << SubBucketBits;
+    static constexpr int MaxMagnitude = 40;  // ~18 minutes
+    static constexpr int64_t MaxValue = (int64_t{1} << (MaxMagnitude + 1)) - 1;
+    static constexpr size_t BucketCount = (MaxMagnitude - SubBucketBits + 2) * SubBucketCount;
+
+    void record(int64_t value) {
+        if (counts.empty()) {
+            counts.assign(BucketCount, 0);
+        }
+        value = std::clamp<int64_t>(value, 0, MaxValue);
+        ++counts[bucketIndex(value)];
+        ++total;
+        sum += value;
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+
+    // Adds every value recorded in other, e.g. to combine per-thread or
+    // per-window histograms
+    void merge(const LatencyHistogram& other) {
+        if (other.total == 0) {
+            return;
+        }
+        if (counts.empty()) {
+            counts.assign(BucketCount, 0);
+        }
+        for (size_t i = 0; i < BucketCount; ++i) {
+            counts[i] += other.counts[i];
+        }
+        total += other.total;
+        sum += other.sum;
+        minimum = std::min(minimum, other.minimum);
+        maximum = std::max(maximum, other.maximum);
+    }
+
+    void reset() {
+        std::fill(counts.begin(), counts.end(), 0);
+        total = 0;
+        sum = 0;
+        minimum = std::numeric_limits<int64_t>::max();
+        maximum = 0;
+    }
+
+    // Smallest bucket bound that at least `percentile` percent of the
+    // recorded values fall under, e.g. percentile(99.9)
+    int64_t percentile(double percentile) const {
+        if (total == 0) {
+            return 0;
+        }
+        const double clamped = std::clamp(percentile, 0.0, 100.0);
+        const uint64_t rank = std::max<uint64_t>(
+            1, static_cast<uint64_t>(clamped / 100.0 * static_cast<double>(total) + 0.5));
+
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BucketCount; ++i) {
+            seen += counts[i];
+            if (seen >= rank) {
+                return std::min(bucketUpperBound(i), maximum);
+            }
+        }
+        return maximum;
+    }
+
+    uint64_t count() const { return total; }
+    int64_t min() const { return total ? minimum : 0; }
+    int64_t max() const { return maximum; }
+    double mean() const { return total ? static_cast<double>(sum) / total : 0.0; }
+
+private:
+    std::vector<uint64_t> counts;  // allocated on first use
+    uint64_t total = 0;
+    int64_t sum = 0;
+    int64_t minimum = std::numeric_limits<int64_t>::max();
+    int64_t maximum = 0;
+
+    static size_t bucketIndex(int64_t value) {
+        const int magnitude = std::bit_width(static_cast<uint64_t>(value)) - 1;
+        if (magnitude < SubBucketBits) {
+            return static_cast<size_t>(value);
+        }
+        const int shift = magnitude - SubBucketBits;
+        return static_cast<size_t>((shift + 1) * SubBucketCount + (value >> shift) - SubBucketCount);
+    }
+
+    static int64_t bucketUpperBound(size_t index) {
+        if (index < static_cast<size_t>(SubBucketCount)) {
+            return static_cast<int64_t>(index);
+        }
+        const int shift = static_cast<int>(index / SubBucketCount) - 1;
+        const int64_t subBucket = static_cast<int64_t>(index % SubBucketCount) + SubBucketCount;
+        return ((subBucket + 1) << shift) - 1;
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -1,57 +1,242 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <functional>
 #include <mutex>
+#include <utility>
 #include <spdlog/spdlog.h>
 
 namespace ForgeEngine {
 namespace Core {
 
+namespace detail {
+
+// Small per-thread index shared by all pools, so each pool can keep one cache
+// per thread in a flat array. Slots of exited threads are handed to new ones.
+class PoolThreadSlots {
+public:
+    static constexpr size_t MaxThreads = 128;
+    static constexpr size_t NoSlot = MaxThreads;
+
+    // Slot of the calling thread, or NoSlot if all are taken or the thread
+    // is already shutting down
+    static size_t current() {
+        if (slot == Unassigned) {
+            slot = claim();
+            if (slot != NoSlot) {
+                static thread_local Releaser releaser;
+            }
+        }
+        return slot;
+    }
+
+private:
+    static constexpr size_t Unassigned = MaxThreads + 1;
+
+    struct Releaser {
+        ~Releaser() {
+            used()[slot].store(false, std::memory_order_release);
+            slot = NoSlot;
+        }
+    };
+
+    inline static thread_local size_t slot = Unassigned;
+
+    static std::array<std::atomic<bool>, MaxThreads>& used() {
+        static std::array<std::atomic<bool>, MaxThreads> slots{};
+        return slots;
+    }
+
+    static size_t claim() {
+        auto& slots = used();
+        for (size_t i = 0; i < MaxThreads; ++i) {
+            bool expected = false;
+            if (!slots[i].load(std::memory_order_relaxed) &&
+                slots[i].compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return i;
+            }
+        }
+        return NoSlot;
+    }
+};
+
+} // namespace detail
+
+// Recycling pool of default-constructed objects, safe to use from any number
+// of threads. Each thread keeps a small cache of two magazines (fixed-size
+// stacks of free objects), so acquire() and release() normally touch only
+// thread-local data; a thread only takes the depot lock to trade a whole
+// magazine, once per MagazineSize operations. A thread caches at most
+// 2 * MagazineSize objects. Objects are allocated in contiguous chunks and
+// live until the pool is destroyed; release() calls T::reset() if T has one.
 template<typename T>
 class ObjectPool {
 public:
+    static constexpr size_t MagazineSize = 32;
+
     ObjectPool(size_t initialSize = 100) {
-        objects.reserve(initialSize);
-        for (size_t i = 0; i < initialSize; ++i) {
-            objects.push_back(std::make_unique<T>());
-            available.push_back(objects.back().get());
+        std::lock_guard<std::mutex> lock(depotMutex);
+        sharedCache.loaded = takeEmptyMagazine();
+        sharedCache.previous = takeEmptyMagazine();
+        for (size_t stocked = 0; stocked < initialSize; stocked += MagazineSize) {
+            fullMagazines.push_back(createStockedMagazine(std::min(MagazineSize, initialSize - stocked)));
         }
     }
 
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
     T* acquire() {
-        std::lock_guard<std::mutex> lock(poolMutex);
-        if (available.empty()) {
-            spdlog::debug("Object pool expanding: creating new object");
-            objects.push_back(std::make_unique<T>());
-            available.push_back(objects.back().get());
+        ThreadCache* cache = localCache();
+        if (!cache) {
+            std::lock_guard<std::mutex> lock(sharedCacheMutex);
+            return acquireFrom(sharedCache);
         }
-
-        T* object = available.back();
-        available.pop_back();
-        return object;
+        return acquireFrom(*cache);
     }
 
     void release(T* object) {
-        std::lock_guard<std::mutex> lock(poolMutex);
-        if (object) {
+        if (!object) {
+            return;
+        }
+        if constexpr (requires(T& value) { value.reset(); }) {
             object->reset();  // Reset object state
-            available.push_back(object);
         }
+        ThreadCache* cache = localCache();
+        if (!cache) {
+            std::lock_guard<std::mutex> lock(sharedCacheMutex);
+            releaseTo(sharedCache, object);
+            return;
+        }
+        releaseTo(*cache, object);
     }
 
+    // Objects not currently handed out, including those sitting in thread
+    // caches. Exact once all threads are quiescent.
     size_t availableCount() const {
-        return available.size();
+        int64_t outstanding = sharedCache.outstanding.load(std::memory_order_relaxed);
+        for (const auto& entry : caches) {
+            if (const ThreadCache* cache = entry.load(std::memory_order_acquire)) {
+                outstanding += cache->outstanding.load(std::memory_order_relaxed);
+            }
+        }
+        return totalCount() - static_cast<size_t>(outstanding);
     }
 
     size_t totalCount() const {
-        return objects.size();
+        return totalObjects.load(std::memory_order_relaxed);
     }
 
 private:
-    std::vector<std::unique_ptr<T>> objects;
-    std::vector<T*> available;
-    std::mutex poolMutex;
+    struct Magazine {
+        size_t count = 0;
+        std::array<T*, MagazineSize> items;
+    };
+
+    // Only touched by the thread owning the slot (sharedCache: under its lock)
+    struct alignas(64) ThreadCache {
+        Magazine* loaded = nullptr;
+        Magazine* previous = nullptr;
+        // Acquires minus releases on this thread; others only read it
+        std::atomic<int64_t> outstanding{0};
+    };
+
+    std::array<std::atomic<ThreadCache*>, detail::PoolThreadSlots::MaxThreads> caches{};
+    ThreadCache sharedCache;  // threads without a slot
+    std::mutex sharedCacheMutex;
+
+    // Depot, guarded by depotMutex
+    std::mutex depotMutex;
+    std::vector<Magazine*> fullMagazines;   // non-empty
+    std::vector<Magazine*> emptyMagazines;
+    std::vector<std::unique_ptr<Magazine>> magazines;
+    std::vector<std::unique_ptr<T[]>> chunks;
+    std::vector<std::unique_ptr<ThreadCache>> cacheStorage;
+    std::atomic<size_t> totalObjects{0};
+
+    ThreadCache* localCache() {
+        const size_t slot = detail::PoolThreadSlots::current();
+        if (slot == detail::PoolThreadSlots::NoSlot) {
+            return nullptr;
+        }
+        ThreadCache* cache = caches[slot].load(std::memory_order_relaxed);
+        if (!cache) {
+            std::lock_guard<std::mutex> lock(depotMutex);
+            cacheStorage.push_back(std::make_unique<ThreadCache>());
+            cache = cacheStorage.back().get();
+            cache->loaded = takeEmptyMagazine();
+            cache->previous = takeEmptyMagazine();
+            caches[slot].store(cache, std::memory_order_release);
+        }
+        return cache;
+    }
+
+    T* acquireFrom(ThreadCache& cache) {
+        if (cache.loaded->count == 0) {
+            if (cache.previous->count > 0) {
+                std::swap(cache.loaded, cache.previous);
+            } else {
+                std::lock_guard<std::mutex> lock(depotMutex);
+                emptyMagazines.push_back(cache.loaded);
+                cache.loaded = takeFullMagazine();
+            }
+        }
+        cache.outstanding.store(cache.outstanding.load(std::memory_order_relaxed) + 1,
+                                std::memory_order_relaxed);
+        return cache.loaded->items[--cache.loaded->count];
+    }
+
+    void releaseTo(ThreadCache& cache, T* object) {
+        if (cache.loaded->count == MagazineSize) {
+            if (cache.previous->count == 0) {
+                std::swap(cache.loaded, cache.previous);
+            } else {
+                std::lock_guard<std::mutex> lock(depotMutex);
+                fullMagazines.push_back(cache.previous);
+                cache.previous = cache.loaded;
+                cache.loaded = takeEmptyMagazine();
+            }
+        }
+        cache.loaded->items[cache.loaded->count++] = object;
+        cache.outstanding.store(cache.outstanding.load(std::memory_order_relaxed) - 1,
+                                std::memory_order_relaxed);
+    }
+
+    // Requires depotMutex
+    Magazine* takeFullMagazine() {
+        if (fullMagazines.empty()) {
+            spdlog::debug("Object pool expanding: creating {} new objects", MagazineSize);
+            return createStockedMagazine(MagazineSize);
+        }
+        Magazine* magazine = fullMagazines.back();
+        fullMagazines.pop_back();
+        return magazine;
+    }
+
+    // Requires depotMutex
+    Magazine* takeEmptyMagazine() {
+        if (emptyMagazines.empty()) {
+            magazines.push_back(std::make_unique<Magazine>());
+            return magazines.back().get();
+        }
+        Magazine* magazine = emptyMagazines.back();
+        emptyMagazines.pop_back();
+        return magazine;
+    }
+
+    // Requires depotMutex
+    Magazine* createStockedMagazine(size_t count) {
+        chunks.push_back(std::make_unique<T[]>(count));
+        Magazine* magazine = takeEmptyMagazine();
+        for (size_t i = 0; i < count; ++i) {
+            magazine->items[magazine->count++] = &chunks.back()[i];
+        }
+        totalObjects.fetch_add(count, std::memory_order_relaxed);
+        return magazine;
+    }
 };
 
 } // namespace Core
@@ -0,0 +1,162 @@
+#pragma once
+#include <array>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ForgeEngine {
+namespace Core {
+
+// One reading of the hardware counters of the calling thread
+struct CounterValues {
+    enum Event : size_t {
+        Cycles,
+        Instructions,
+        L1DataMisses,
+        LastLevelMisses,
+        BranchMisses,
+        EventCount
+    };
+
+    std::array<uint64_t, EventCount> values;  // left uninitialized; read() fills it
+
+    static const char* eventName(size_t event) {
+        static constexpr const char* names[EventCount] = {
+            "cycles", "instructions", "L1d misses", "LLC misses", "branch misses"
+        };
+        return names[event];
+    }
+};
+
+// Hardware counters of one thread, opened through Linux perf_event_open as a
+// single group so all events are read in one syscall and cover the same
+// interval. User-space only. Events the CPU or kernel does not provide (VMs
+// often lack the cache events) are left out; if none can be opened - no PMU,
+// perf_event_paranoid too strict, or a container seccomp profile blocking
+// the syscall - valid() is false and read() always fails. On other platforms
+// the group is never valid.
+class PerfCounterGroup {
+public:
+    PerfCounterGroup() {
+        fds.fill(-1);
+        slots.fill(-1);
+#if defined(__linux__)
+        static constexpr std::array<std::pair<uint32_t, uint64_t>, CounterValues::EventCount> events = {{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+                                 (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                 (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        }};
+
+        for (size_t event = 0; event < events.size(); ++event) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = events[event].first;
+            attr.config = events[event].second;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                               PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.disabled = leaderFd < 0 ? 1 : 0;
+
+            // pid 0, cpu -1: this thread, on whichever CPU it runs
+            const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leaderFd, 0));
+            if (fd < 0) {
+                if (leaderFd < 0) {
+                    openError = errno;
+                }
+                continue;
+            }
+            if (leaderFd < 0) {
+                leaderFd = fd;
+            }
+            fds[event] = fd;
+            slots[event] = static_cast<int8_t>(memberCount++);
+        }
+
+        if (leaderFd >= 0) {
+            openError = 0;
+            ioctl(leaderFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#else
+        openError = ENOSYS;
+#endif
+    }
+
+    ~PerfCounterGroup() {
+#if defined(__linux__)
+        for (int fd : fds) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+    // The calling thread's counters, opened on first use
+    static PerfCounterGroup& forThisThread() {
+        static thread_local PerfCounterGroup group;
+        return group;
+    }
+
+    bool valid() const { return leaderFd >= 0; }
+
+    bool supports(size_t event) const { return slots[event] >= 0; }
+
+    // errno of the failed open when !valid()
+    int error() const { return openError; }
+
+    // Current counts, scaled up if the kernel had to multiplex the group;
+    // unsupported events read as zero
+    bool read(CounterValues& out) const {
+#if defined(__linux__)
+        if (leaderFd < 0) {
+            return false;
+        }
+        // nr, time_enabled, time_running, then one value per member
+        std::array<uint64_t, 3 + CounterValues::EventCount> buffer;
+        const ssize_t expected = static_cast<ssize_t>((3 + memberCount) * sizeof(uint64_t));
+        if (::read(leaderFd, buffer.data(), sizeof(buffer)) != expected) {
+            return false;
+        }
+        const uint64_t enabled = buffer[1];
+        const uint64_t running = buffer[2];
+        for (size_t event = 0; event < CounterValues::EventCount; ++event) {
+            uint64_t value = slots[event] >= 0 ? buffer[3 + slots[event]] : 0;
+            if (running > 0 && running < enabled) {
+                value = static_cast<uint64_t>(static_cast<double>(value) * enabled / running);
+            }
+            out.values[event] = value;
+        }
+        return true;
+#else
+        (void)out;
+        return false;
+#endif
+    }
+
+private:
+    std::array<int, CounterValues::EventCount> fds;
+    std::array<int8_t, CounterValues::EventCount> slots;  // position in a group read
+    int leaderFd = -1;
+    int memberCount = 0;
+    int openError = 0;
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -1,92 +1,937 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include <spdlog/spdlog.h>
+#include "LatencyHistogram.h"
+#include "PerfCounters.h"
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 namespace ForgeEngine {
 namespace Core {
 
+struct ProfileZone;
+
+// Low-overhead scope profiler. Every PROFILE_SCOPE call site owns a static
+// ProfileZone that is registered once and gets a small integer ID. Each thread
+// records finished scopes as (zone ID, start, end) into its own fixed-size
+// ring buffer without taking locks; endFrame() drains every thread's buffer
+// into the shared per-zone statistics. Timestamps are raw CPU ticks on the
+// hot path and only converted to nanoseconds when merged.
+//
+// Every zone keeps a latency histogram, for the whole run and for the current
+// window (see resetWindow()), queryable through getStats().
+//
+// The merged events can also be kept as a timeline and written out as a
+// Chrome Trace Event file (chrome://tracing, ui.perfetto.dev), either for the
+// next N frames or continuously for the most recent N frames.
+//
+// Zones can be given a per-frame time budget. endFrame() checks them every
+// tick; repeated overruns write the last frames to disk (a flight recorder)
+// and notify an overrun handler.
+//
+// On Linux, scopes can additionally sample the thread's hardware counters
+// (see enableHardwareCounters()) to tell cache- or branch-bound zones apart.
 class Profiler {
 public:
+    static constexpr uint32_t MaxZones = 4096;
+    // Shared by every call site registered after the table filled up
+    static constexpr uint32_t OverflowZoneId = 0;
+    // Code outside any zone
+    static constexpr uint32_t UntaggedZoneId = 1;
+
+    // Snapshot of one zone's timings; durations in nanoseconds
+    struct ZoneStats {
+        const char* name;
+        const char* file;
+        uint32_t line;
+        uint64_t callCount;
+        double averageTime;
+        int64_t maxTime;
+        int64_t p50;
+        int64_t p90;
+        int64_t p99;
+        int64_t p999;
+    };
+
+    // Handlers run without the profiler's lock and may change budgets, so
+    // everything here is a copy
+    struct BudgetOverrun {
+        std::string zone;
+        int64_t budget;          // nanoseconds per frame
+        int64_t frameTime;       // spent in the zone this frame
+        uint64_t frameIndex;
+        uint64_t overrunCount;   // since the budget was set
+        std::string tracePath;   // flight recorder dump, empty if none
+    };
+
+    using OverrunCallback = std::function<void(const BudgetOverrun&)>;
+
+    // Hardware counter totals of one zone. Counts are inclusive of nested
+    // zones; events the machine doesn't support stay zero.
+    struct ZoneCounterStats {
+        const char* name;
+        uint64_t callCount;  // calls that were counted
+        CounterValues totals;
+
+        double instructionsPerCycle() const {
+            const uint64_t cycles = totals.values[CounterValues::Cycles];
+            return cycles ? static_cast<double>(totals.values[CounterValues::Instructions]) / cycles : 0.0;
+        }
+
+        double perCall(CounterValues::Event event) const {
+            return callCount ? static_cast<double>(totals.values[event]) / callCount : 0.0;
+        }
+    };
+
     static Profiler& getInstance() {
-        static Profiler instance;
-        return instance;
+        // Never destroyed: worker threads may still record while static
+        // destructors run
+        static Profiler* instance = new Profiler();
+        return *instance;
+    }
+
+    static int64_t now() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+    }
+
+    // Timestamp used on the hot path; only differences are meaningful
+    static int64_t ticks() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+        return static_cast<int64_t>(__rdtsc());
+#else
+        return now();
+#endif
+    }
+
+    int64_t ticksToNanoseconds(int64_t tickCount) const {
+        return static_cast<int64_t>(static_cast<double>(tickCount) * nanosecondsPerTick);
+    }
+
+    // Assigns the next zone ID. Runs once per call site, from the zone's
+    // static initializer.
+    uint32_t registerZone(const ProfileZone* zone) {
+        const uint32_t id = nextZoneId.fetch_add(1, std::memory_order_relaxed);
+        if (id >= MaxZones) {
+            nextZoneId.store(MaxZones, std::memory_order_relaxed);
+            return OverflowZoneId;
+        }
+        zones[id].store(zone, std::memory_order_release);
+        return id;
+    }
+
+    // Registers a zone for a name that is only known at runtime, such as a
+    // scheduled system. The same name always maps to the same zone.
+    uint32_t internZone(const std::string& name);
+
+    const char* zoneName(uint32_t id) const;
+
+    // Innermost zone open on the calling thread, i.e. the zone allocations
+    // are charged to
+    static uint32_t currentZone() {
+        return activeZone;
+    }
+
+    static uint32_t enterZone(uint32_t zoneId) {
+        return std::exchange(activeZone, zoneId);
     }
 
-    void beginProfile(const std::string& name) {
-        auto& profile = profiles[name];
-        profile.startTime = std::chrono::high_resolution_clock::now();
-        profile.isRunning = true;
+    static void leaveZone(uint32_t previousZone) {
+        activeZone = previousZone;
     }
 
-    void endProfile(const std::string& name) {
-        auto& profile = profiles[name];
-        if (profile.isRunning) {
-            auto endTime = std::chrono::high_resolution_clock::now();
-            auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
-                endTime - profile.startTime
-            ).count();
+    // Hot path: appends one finished scope to the calling thread's buffer.
+    // Times come from ticks().
+    void record(uint32_t zoneId, int64_t startTime, int64_t endTime) {
+        ThreadBuffer* buffer = localBuffer;
+        if (!buffer) {
+            buffer = registerThread();
+        }
+        buffer->push(zoneId, startTime, endTime);
+    }
 
-            profile.totalTime += duration;
-            profile.callCount++;
-            profile.isRunning = false;
+    // Label for the calling thread in exported traces
+    void setThreadName(std::string name) {
+        ThreadBuffer* buffer = localBuffer;
+        if (!buffer) {
+            buffer = registerThread();
+        }
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        threadNames[buffer->threadId] = std::move(name);
+    }
+
+    // Merges everything recorded since the last call into the statistics.
+    // Called once per simulation tick.
+    void endFrame() {
+        std::vector<BudgetOverrun> overruns;
+        OverrunCallback callback;
+        {
+            std::lock_guard<std::mutex> lock(mergeMutex);
+            drainBuffers();
+            finishTraceFrame();
+            checkBudgets(overruns);
+            callback = overrunCallback;
+        }
 
-            if (duration > profile.maxTime) {
-                profile.maxTime = duration;
-                spdlog::debug("New max time for {}: {} microseconds", name, duration);
+        // Outside the lock so handlers may use the profiler
+        for (const auto& overrun : overruns) {
+            spdlog::warn("{} took {:.2f}ms in frame {} (budget {:.2f}ms)",
+                         overrun.zone, overrun.frameTime / 1e6, overrun.frameIndex, overrun.budget / 1e6);
+            if (callback) {
+                callback(overrun);
             }
         }
     }
 
+    // Time all calls to zones named `zone` may take per frame, summed
+    // across threads
+    void setBudget(const std::string& zone, double milliseconds) {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        const int64_t limit = static_cast<int64_t>(milliseconds * 1e6);
+        auto it = std::find_if(budgets.begin(), budgets.end(),
+                               [&zone](const Budget& budget) { return budget.zone == zone; });
+        if (it != budgets.end()) {
+            it->limit = limit;
+            it->overruns = 0;
+        } else {
+            budgets.push_back(Budget{zone, limit, 0, 0});
+        }
+        mapZoneBudgets(0);
+    }
+
+    void clearBudgets() {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        budgets.clear();
+        mapZoneBudgets(0);
+    }
+
+    // Every overrunThreshold-th overrun of a budget calls callback. With
+    // recorderFrames > 0 the profiler always keeps that many frames of
+    // events and writes them to dumpDirectory before calling back.
+    void setOverrunHandler(OverrunCallback callback, uint32_t overrunThreshold = 1,
+                           size_t recorderFrames = 0, std::string dumpDirectory = "profiles/") {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        overrunCallback = std::move(callback);
+        overrunsPerAlert = std::max<uint32_t>(1, overrunThreshold);
+        flightRecorderFrames = recorderFrames;
+        flightRecorderDirectory = std::move(dumpDirectory);
+        trimRecentFrames();
+    }
+
+    // Records the timeline of the next frameCount frames and writes it to
+    // path as Chrome trace JSON once they are done.
+    void captureFrames(size_t frameCount, std::string path) {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        capturedFrames.clear();
+        captureRemaining = frameCount;
+        capturePath = std::move(path);
+    }
+
+    // Continuously keeps the timeline of the last frameCount frames in
+    // memory, ready for writeTrace(). 0 turns it off.
+    void setTraceHistory(size_t frameCount) {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        traceHistory = frameCount;
+        trimRecentFrames();
+    }
+
+    // Writes the frames currently kept in memory (see setTraceHistory() and
+    // setOverrunHandler()) as Chrome trace JSON. Returns false if the file
+    // can't be written.
+    bool writeTrace(const std::string& path) {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        return writeChromeTrace(path, recentFrames);
+    }
+
+    // Makes every scope read the hardware counters of its thread on entry
+    // and exit. That costs two syscalls per scope, so it is meant for
+    // diagnosis rather than always-on use. Returns false, leaving counting
+    // off, when this thread can't open any counter; other threads that can't
+    // simply go uncounted.
+    bool enableHardwareCounters(bool enable) {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        if (!enable) {
+            hardwareCounting.store(false, std::memory_order_relaxed);
+            return true;
+        }
+
+        const PerfCounterGroup& group = PerfCounterGroup::forThisThread();
+        if (!group.valid()) {
+            spdlog::warn("Hardware counters unavailable: {} (check perf_event_paranoid "
+                         "or the container's seccomp profile)", std::strerror(group.error()));
+            return false;
+        }
+        for (size_t event = 0; event < CounterValues::EventCount; ++event) {
+            if (!group.supports(event)) {
+                spdlog::info("Hardware counter '{}' not supported here", CounterValues::eventName(event));
+            }
+        }
+
+        if (!counterTotals.load(std::memory_order_relaxed)) {
+            // Never freed; scopes on other threads may still be adding to it
+            counterTotals.store(new CounterTotals[MaxZones], std::memory_order_release);
+        }
+        hardwareCounting.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    static bool countingHardware() {
+        return hardwareCounting.load(std::memory_order_relaxed);
+    }
+
+    void recordCounters(uint32_t zoneId, const CounterValues& start, const CounterValues& end) {
+        CounterTotals* totals = counterTotals.load(std::memory_order_acquire);
+        if (!totals) {
+            return;
+        }
+        CounterTotals& zone = totals[zoneId];
+        zone.calls.fetch_add(1, std::memory_order_relaxed);
+        for (size_t event = 0; event < CounterValues::EventCount; ++event) {
+            zone.values[event].fetch_add(end.values[event] - start.values[event], std::memory_order_relaxed);
+        }
+    }
+
+    // Zones with counted calls since reset()
+    std::vector<ZoneCounterStats> getCounterStats() {
+        std::vector<ZoneCounterStats> stats;
+        const CounterTotals* totals = counterTotals.load(std::memory_order_acquire);
+        if (!totals) {
+            return stats;
+        }
+        for (uint32_t id = 0; id < MaxZones; ++id) {
+            const uint64_t calls = totals[id].calls.load(std::memory_order_relaxed);
+            if (calls == 0) {
+                continue;
+            }
+            ZoneCounterStats zone{zoneName(id), calls, {}};
+            for (size_t event = 0; event < CounterValues::EventCount; ++event) {
+                zone.totals.values[event] = totals[id].values[event].load(std::memory_order_relaxed);
+            }
+            stats.push_back(zone);
+        }
+        return stats;
+    }
+
     void reset() {
-        profiles.clear();
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        drainBuffers();
+        profiles.assign(profiles.size(), ProfileData{});
+        if (CounterTotals* totals = counterTotals.load(std::memory_order_acquire)) {
+            for (uint32_t id = 0; id < MaxZones; ++id) {
+                totals[id].calls.store(0, std::memory_order_relaxed);
+                for (auto& value : totals[id].values) {
+                    value.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    // Starts a new statistics window: the window's durations are folded into
+    // the run totals and the window histograms start empty
+    void resetWindow() {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        drainBuffers();
+        for (auto& profile : profiles) {
+            profile.history.merge(profile.window);
+            profile.window.reset();
+        }
+    }
+
+    // Per-zone timings since reset(), or only since resetWindow()
+    std::vector<ZoneStats> getStats(bool windowOnly = false) {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        drainBuffers();
+        std::vector<ZoneStats> stats;
+        for (uint32_t id = 0; id < profiles.size(); ++id) {
+            LatencyHistogram histogram = zoneHistogram(id, windowOnly);
+            if (histogram.count() > 0) {
+                stats.push_back(makeStats(id, histogram));
+            }
+        }
+        return stats;
+    }
+
+    // Copy of the histogram of every zone called `name`
+    LatencyHistogram getHistogram(const std::string& name, bool windowOnly = false) {
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        drainBuffers();
+        LatencyHistogram result;
+        for (uint32_t id = 0; id < profiles.size(); ++id) {
+            if (name == zoneName(id)) {
+                result.merge(zoneHistogram(id, windowOnly));
+            }
+        }
+        return result;
     }
 
     void printStats() {
-        for (const auto& [name, profile] : profiles) {
-            if (profile.callCount > 0) {
-                double avgTime = static_cast<double>(profile.totalTime) / profile.callCount;
+        std::lock_guard<std::mutex> lock(mergeMutex);
+        drainBuffers();
+        for (uint32_t id = 0; id < profiles.size(); ++id) {
+            const LatencyHistogram histogram = zoneHistogram(id, false);
+            if (histogram.count() > 0) {
+                const ZoneStats zone = makeStats(id, histogram);
                 spdlog::info(
-                    "{} Stats:\n  Calls: {}\n  Avg Time: {:.2f}us\n  Max Time: {}us",
-                    name, profile.callCount, avgTime, profile.maxTime
+                    "{} Stats:\n  Calls: {}\n  Avg Time: {:.2f}us\n  Max Time: {}us\n"
+                    "  p50: {:.2f}us  p90: {:.2f}us  p99: {:.2f}us  p99.9: {:.2f}us",
+                    zone.name, zone.callCount, zone.averageTime / 1000.0, zone.maxTime / 1000,
+                    zone.p50 / 1000.0, zone.p90 / 1000.0, zone.p99 / 1000.0, zone.p999 / 1000.0
                 );
             }
         }
+        for (const auto& zone : getCounterStats()) {
+            spdlog::info(
+                "{} Counters:\n  IPC: {:.2f}\n  Per call: {:.0f} cycles, {:.0f} L1d misses, "
+                "{:.0f} LLC misses, {:.0f} branch misses",
+                zone.name, zone.instructionsPerCycle(), zone.perCall(CounterValues::Cycles),
+                zone.perCall(CounterValues::L1DataMisses), zone.perCall(CounterValues::LastLevelMisses),
+                zone.perCall(CounterValues::BranchMisses)
+            );
+        }
+        const uint64_t dropped = droppedEvents.load(std::memory_order_relaxed);
+        if (dropped > 0) {
+            spdlog::warn("Profiler dropped {} events; call endFrame() more often", dropped);
+        }
     }
 
 private:
     struct ProfileData {
-        std::chrono::high_resolution_clock::time_point startTime;
-        int64_t totalTime = 0;
-        int64_t maxTime = 0;
-        size_t callCount = 0;
-        bool isRunning = false;
+        LatencyHistogram window;   // since resetWindow()
+        LatencyHistogram history;  // earlier windows since reset()
+    };
+
+    struct Event {
+        uint32_t zoneId;
+        uint32_t threadId;
+        int64_t startTime;
+        int64_t endTime;
+    };
+
+    // Timeline of one merged frame; times in nanoseconds since startup
+    struct TraceFrame {
+        uint64_t index = 0;
+        int64_t startTime = 0;
+        int64_t endTime = 0;
+        std::vector<Event> events;
+    };
+
+    struct Budget {
+        std::string zone;
+        int64_t limit;
+        int64_t frameTime;
+        uint64_t overruns;
+    };
+
+    static constexpr int32_t NoBudget = -1;
+
+    // Single-producer/single-consumer ring: the owning thread pushes, the
+    // thread holding mergeMutex drains. Full buffers drop new events.
+    struct ThreadBuffer {
+        static constexpr size_t Capacity = 1 << 16;
+
+        std::vector<Event> events = std::vector<Event>(Capacity);
+        alignas(64) std::atomic<size_t> head{0};
+        alignas(64) std::atomic<size_t> tail{0};
+        // Last head the owning thread saw; head is only re-read when the
+        // buffer looks full, so pushes don't touch the drainer's cache line
+        size_t cachedHead = 0;
+        std::atomic<bool> retired{false};
+        uint32_t threadId = 0;  // only touched by the owning thread
+        ThreadBuffer* next = nullptr;
+
+        void push(uint32_t zoneId, int64_t startTime, int64_t endTime) {
+            const size_t position = tail.load(std::memory_order_relaxed);
+            if (position - cachedHead == Capacity) {
+                cachedHead = head.load(std::memory_order_acquire);
+                if (position - cachedHead == Capacity) {
+                    Profiler::getInstance().droppedEvents.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+            events[position & (Capacity - 1)] = Event{zoneId, threadId, startTime, endTime};
+            tail.store(position + 1, std::memory_order_release);
+        }
     };
 
-    std::unordered_map<std::string, ProfileData> profiles;
+    // Hands the buffer back for reuse when its thread exits
+    struct ThreadRetirer {
+        ThreadBuffer* buffer = nullptr;
+        ~ThreadRetirer() {
+            if (buffer) {
+                localBuffer = nullptr;
+                buffer->retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    inline static thread_local ThreadBuffer* localBuffer = nullptr;
+    inline static thread_local uint32_t activeZone = UntaggedZoneId;
+
+    double nanosecondsPerTick = 1.0;
+    int64_t startTicks = 0;
 
-    Profiler() = default;
+    std::array<std::atomic<const ProfileZone*>, MaxZones> zones{};
+    std::atomic<uint32_t> nextZoneId{UntaggedZoneId + 1};
+
+    std::atomic<ThreadBuffer*> buffers{nullptr};
+    std::atomic<uint64_t> droppedEvents{0};
+    std::atomic<uint32_t> nextThreadId{0};
+
+    std::mutex mergeMutex;
+    std::vector<ProfileData> profiles;  // indexed by zone ID
+
+    // Timeline capture, all guarded by mergeMutex
+    std::unordered_map<uint32_t, std::string> threadNames;
+    TraceFrame currentFrame;
+    uint64_t frameIndex = 0;
+    size_t traceHistory = 0;
+    std::deque<TraceFrame> recentFrames;
+    size_t captureRemaining = 0;
+    std::string capturePath;
+    std::deque<TraceFrame> capturedFrames;
+
+    // Frame budgets, guarded by mergeMutex
+    std::vector<Budget> budgets;
+    std::vector<int32_t> zoneBudgets;  // zone ID -> index into budgets
+    OverrunCallback overrunCallback;
+    uint32_t overrunsPerAlert = 1;
+    size_t flightRecorderFrames = 0;
+    std::string flightRecorderDirectory;
+
+    // Hardware counter totals per zone, allocated when counting is first
+    // enabled
+    struct CounterTotals {
+        std::atomic<uint64_t> calls{0};
+        std::array<std::atomic<uint64_t>, CounterValues::EventCount> values{};
+    };
+    inline static std::atomic<bool> hardwareCounting{false};
+    std::atomic<CounterTotals*> counterTotals{nullptr};
+
+    // Zones created by internZone(); node-based, so names never move
+    std::mutex internMutex;
+    std::unordered_map<std::string, std::unique_ptr<ProfileZone>> internedZones;
+
+    Profiler() {
+        calibrate();
+    }
     ~Profiler() = default;
+
+    void calibrate() {
+        const int64_t startNs = now();
+        const int64_t calibrationTicks = ticks();
+        while (now() - startNs < 2'000'000) {
+        }
+        const int64_t elapsedTicks = ticks() - calibrationTicks;
+        if (elapsedTicks > 0) {
+            nanosecondsPerTick = static_cast<double>(now() - startNs) / elapsedTicks;
+        }
+        startTicks = ticks();
+    }
+
+    ThreadBuffer* registerThread() {
+        ThreadBuffer* buffer = nullptr;
+
+        // Reuse the buffer of a thread that has exited, if any
+        for (ThreadBuffer* it = buffers.load(std::memory_order_acquire); it; it = it->next) {
+            bool wasRetired = true;
+            if (it->retired.compare_exchange_strong(wasRetired, false, std::memory_order_acq_rel)) {
+                buffer = it;
+                break;
+            }
+        }
+
+        if (!buffer) {
+            // Profiler bookkeeping, not the zone that happened to record first
+            const uint32_t previousZone = enterZone(UntaggedZoneId);
+            buffer = new ThreadBuffer();
+            leaveZone(previousZone);
+            ThreadBuffer* head = buffers.load(std::memory_order_relaxed);
+            do {
+                buffer->next = head;
+            } while (!buffers.compare_exchange_weak(head, buffer, std::memory_order_release,
+                                                    std::memory_order_relaxed));
+        }
+
+        // Fresh ID even for a reused buffer, so traces tell the threads apart
+        buffer->threadId = nextThreadId.fetch_add(1, std::memory_order_relaxed);
+
+        static thread_local ThreadRetirer retirer;
+        retirer.buffer = buffer;
+        localBuffer = buffer;
+        return buffer;
+    }
+
+    size_t retainedFrames() const {
+        return std::max(traceHistory, flightRecorderFrames);
+    }
+
+    bool tracing() const {
+        return retainedFrames() > 0 || captureRemaining > 0;
+    }
+
+    void trimRecentFrames() {
+        while (recentFrames.size() > retainedFrames()) {
+            recentFrames.pop_front();
+        }
+    }
+
+    // Requires mergeMutex
+    void drainBuffers() {
+        const bool keepEvents = tracing();
+        for (ThreadBuffer* buffer = buffers.load(std::memory_order_acquire); buffer; buffer = buffer->next) {
+            const size_t end = buffer->tail.load(std::memory_order_acquire);
+            size_t position = buffer->head.load(std::memory_order_relaxed);
+            for (; position != end; ++position) {
+                const Event& event = buffer->events[position & (ThreadBuffer::Capacity - 1)];
+                accumulate(event);
+                if (keepEvents) {
+                    currentFrame.events.push_back(Event{
+                        event.zoneId, event.threadId,
+                        ticksToNanoseconds(event.startTime - startTicks),
+                        ticksToNanoseconds(event.endTime - startTicks)
+                    });
+                }
+            }
+            buffer->head.store(position, std::memory_order_release);
+        }
+    }
+
+    // Requires mergeMutex
+    void finishTraceFrame() {
+        const int64_t frameEnd = ticksToNanoseconds(ticks() - startTicks);
+        TraceFrame frame = std::move(currentFrame);
+        frame.index = frameIndex++;
+        frame.endTime = frameEnd;
+        currentFrame = TraceFrame{};
+        currentFrame.startTime = frameEnd;
+
+        if (captureRemaining > 0) {
+            capturedFrames.push_back(frame);
+            if (--captureRemaining == 0) {
+                if (!writeChromeTrace(capturePath, capturedFrames)) {
+                    spdlog::error("Failed to write profiler capture to {}", capturePath);
+                }
+                capturedFrames.clear();
+            }
+        }
+
+        if (retainedFrames() > 0) {
+            recentFrames.push_back(std::move(frame));
+            trimRecentFrames();
+        }
+    }
+
+    // Points zone IDs from firstZone on at their budget, if any
+    void mapZoneBudgets(size_t firstZone) {
+        zoneBudgets.resize(profiles.size(), NoBudget);
+        for (size_t id = firstZone; id < zoneBudgets.size(); ++id) {
+            zoneBudgets[id] = NoBudget;
+            for (size_t i = 0; i < budgets.size(); ++i) {
+                if (budgets[i].zone == zoneName(static_cast<uint32_t>(id))) {
+                    zoneBudgets[id] = static_cast<int32_t>(i);
+                }
+            }
+        }
+    }
+
+    // Requires mergeMutex; runs after finishTraceFrame()
+    void checkBudgets(std::vector<BudgetOverrun>& overruns) {
+        const uint64_t finishedFrame = frameIndex - 1;
+        for (auto& budget : budgets) {
+            const int64_t frameTime = std::exchange(budget.frameTime, 0);
+            if (frameTime <= budget.limit || ++budget.overruns % overrunsPerAlert != 0) {
+                continue;
+            }
+
+            std::string tracePath;
+            if (flightRecorderFrames > 0) {
+                std::error_code error;
+                std::filesystem::create_directories(flightRecorderDirectory, error);
+                tracePath = (std::filesystem::path(flightRecorderDirectory) /
+                             fmt::format("overrun_{}_frame{}.json", budget.zone, finishedFrame)).string();
+                if (!writeChromeTrace(tracePath, recentFrames, flightRecorderFrames)) {
+                    spdlog::error("Failed to write flight recorder dump to {}", tracePath);
+                    tracePath.clear();
+                }
+            }
+
+            overruns.push_back(BudgetOverrun{
+                budget.zone, budget.limit, frameTime, finishedFrame, budget.overruns, tracePath
+            });
+        }
+    }
+
+    static void writeJsonString(std::ostream& out, const char* text) {
+        out << '"';
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') {
+                out << '\\';
+            }
+            out << *c;
+        }
+        out << '"';
+    }
+
+    // Writes at most the last maxFrames of frames
+    bool writeChromeTrace(const std::string& path, const std::deque<TraceFrame>& frames,
+                          size_t maxFrames = SIZE_MAX) const;
+
+    void accumulate(const Event& event) {
+        if (event.zoneId >= profiles.size()) {
+            const size_t firstNewZone = profiles.size();
+            profiles.resize(event.zoneId + 1);
+            mapZoneBudgets(firstNewZone);
+        }
+        ProfileData& profile = profiles[event.zoneId];
+
+        const int64_t duration = ticksToNanoseconds(event.endTime - event.startTime);
+        if (zoneBudgets[event.zoneId] != NoBudget) {
+            budgets[zoneBudgets[event.zoneId]].frameTime += duration;
+        }
+        if (duration > std::max(profile.window.max(), profile.history.max())) {
+            spdlog::debug("New max time for {}: {} microseconds", zoneName(event.zoneId), duration / 1000);
+        }
+        profile.window.record(duration);
+    }
+
+    // Requires mergeMutex
+    LatencyHistogram zoneHistogram(uint32_t id, bool windowOnly) const {
+        LatencyHistogram histogram = profiles[id].window;
+        if (!windowOnly) {
+            histogram.merge(profiles[id].history);
+        }
+        return histogram;
+    }
+
+    ZoneStats makeStats(uint32_t id, const LatencyHistogram& histogram) const;
 };
 
+// Static description of one PROFILE_SCOPE call site. Lives for the whole
+// program, so the hot path only has to carry its ID around.
+struct ProfileZone {
+    const char* name;
+    const char* file;
+    uint32_t line;
+    uint32_t id;
+
+    ProfileZone(const char* zoneName, const char* zoneFile, uint32_t zoneLine)
+        : name(zoneName), file(zoneFile), line(zoneLine),
+          id(Profiler::getInstance().registerZone(this)) {}
+
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+};
+
+inline uint32_t Profiler::internZone(const std::string& name) {
+    std::lock_guard<std::mutex> lock(internMutex);
+    auto [it, inserted] = internedZones.try_emplace(name);
+    if (inserted) {
+        it->second = std::make_unique<ProfileZone>(it->first.c_str(), "", 0);
+    }
+    return it->second->id;
+}
+
+inline Profiler::ZoneStats Profiler::makeStats(uint32_t id, const LatencyHistogram& histogram) const {
+    const ProfileZone* zone = id < MaxZones ? zones[id].load(std::memory_order_acquire) : nullptr;
+    return ZoneStats{
+        zoneName(id),
+        zone ? zone->file : "",
+        zone ? zone->line : 0,
+        histogram.count(),
+        histogram.mean(),
+        histogram.max(),
+        histogram.percentile(50.0),
+        histogram.percentile(90.0),
+        histogram.percentile(99.0),
+        histogram.percentile(99.9)
+    };
+}
+
+inline const char* Profiler::zoneName(uint32_t id) const {
+    if (id == OverflowZoneId) {
+        return "Profiler_ZoneOverflow";
+    }
+    if (id == UntaggedZoneId) {
+        return "Untagged";
+    }
+    const ProfileZone* zone = id < MaxZones ? zones[id].load(std::memory_order_acquire) : nullptr;
+    return zone ? zone->name : "<unknown>";
+}
+
+// Chrome Trace Event format with begin/end pairs per thread. Scopes on one
+// thread always nest, so sorting by start (outermost first) and closing
+// everything that ended before the next begin keeps the pairs balanced.
+inline bool Profiler::writeChromeTrace(const std::string& path, const std::deque<TraceFrame>& allFrames,
+                                       size_t maxFrames) const {
+    std::ofstream out(path);
+    if (!out) {
+        return false;
+    }
+
+    std::vector<const TraceFrame*> frames;
+    const size_t skipped = allFrames.size() > maxFrames ? allFrames.size() - maxFrames : 0;
+    for (size_t i = skipped; i < allFrames.size(); ++i) {
+        frames.push_back(&allFrames[i]);
+    }
+
+    std::vector<Event> events;
+    for (const TraceFrame* frame : frames) {
+        events.insert(events.end(), frame->events.begin(), frame->events.end());
+    }
+    std::sort(events.begin(), events.end(), [](const Event& a, const Event& b) {
+        if (a.threadId != b.threadId) return a.threadId < b.threadId;
+        if (a.startTime != b.startTime) return a.startTime < b.startTime;
+        return a.endTime > b.endTime;
+    });
+
+    bool first = true;
+    auto beginEvent = [&]() -> std::ostream& {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        return out;
+    };
+    auto writeBoundary = [&](const Event& event, bool begin) {
+        beginEvent() << "{\"name\":";
+        writeJsonString(out, zoneName(event.zoneId));
+        out << fmt::format(",\"cat\":\"zone\",\"ph\":\"{}\",\"ts\":{:.3f},\"pid\":1,\"tid\":{}",
+                           begin ? 'B' : 'E',
+                           (begin ? event.startTime : event.endTime) / 1000.0,
+                           event.threadId);
+        const ProfileZone* zone = event.zoneId < MaxZones ? zones[event.zoneId].load() : nullptr;
+        if (begin && zone) {
+            out << ",\"args\":{\"file\":";
+            writeJsonString(out, zone->file);
+            out << ",\"line\":" << zone->line << '}';
+        }
+        out << '}';
+    };
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    for (const auto& [threadId, name] : threadNames) {
+        beginEvent() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadId
+                     << ",\"args\":{\"name\":";
+        writeJsonString(out, name.c_str());
+        out << "}}";
+    }
+
+    for (const TraceFrame* frame : frames) {
+        beginEvent() << fmt::format(
+            "{{\"name\":\"Frame {}\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":{:.3f},\"pid\":1,\"tid\":0}}",
+            frame->index, frame->endTime / 1000.0);
+    }
+
+    std::vector<const Event*> open;
+    for (size_t i = 0; i < events.size(); ++i) {
+        const Event& event = events[i];
+        while (!open.empty() && (open.back()->threadId != event.threadId ||
+                                 open.back()->endTime <= event.startTime)) {
+            writeBoundary(*open.back(), false);
+            open.pop_back();
+        }
+        writeBoundary(event, true);
+        open.push_back(&event);
+    }
+    while (!open.empty()) {
+        writeBoundary(*open.back(), false);
+        open.pop_back();
+    }
+
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
 // Scope-based profiler helper
 class ScopedProfiler {
 public:
-    explicit ScopedProfiler(const std::string& name) : name(name) {
-        Profiler::getInstance().beginProfile(name);
-    }
+    explicit ScopedProfiler(const ProfileZone& zone) : ScopedProfiler(zone.id) {}
+
+    // For zones from Profiler::internZone()
+    explicit ScopedProfiler(uint32_t zone)
+        : zoneId(zone), previousZone(Profiler::enterZone(zone)),
+          countingHardware(Profiler::countingHardware() &&
+                           PerfCounterGroup::forThisThread().read(startCounters)),
+          startTime(Profiler::ticks()) {}
 
     ~ScopedProfiler() {
-        Profiler::getInstance().endProfile(name);
+        const int64_t endTime = Profiler::ticks();
+        Profiler& profiler = Profiler::getInstance();
+        CounterValues endCounters;
+        if (countingHardware && PerfCounterGroup::forThisThread().read(endCounters)) {
+            profiler.recordCounters(zoneId, startCounters, endCounters);
+        }
+        profiler.record(zoneId, startTime, endTime);
+        Profiler::leaveZone(previousZone);
     }
 
+    ScopedProfiler(const ScopedProfiler&) = delete;
+    ScopedProfiler& operator=(const ScopedProfiler&) = delete;
+
 private:
-    std::string name;
+    uint32_t zoneId;
+    uint32_t previousZone;
+    CounterValues startCounters;
+    bool countingHardware;
+    int64_t startTime;
+};
+
+// Makes a zone current without timing it, so allocations made in the scope
+// are attributed to it. Used to tag subsystems and to carry the submitting
+// zone over to pool tasks.
+class MemoryTag {
+public:
+    explicit MemoryTag(const ProfileZone& zone) : MemoryTag(zone.id) {}
+
+    explicit MemoryTag(uint32_t zone) : previousZone(Profiler::enterZone(zone)) {}
+
+    ~MemoryTag() {
+        Profiler::leaveZone(previousZone);
+    }
+
+    MemoryTag(const MemoryTag&) = delete;
+    MemoryTag& operator=(const MemoryTag&) = delete;
+
+private:
+    uint32_t previousZone;
 };
 
 } // namespace Core
 } // namespace ForgeEngine
 
-// Macro for easy profiling
-#define PROFILE_SCOPE(name) ForgeEngine::Core::ScopedProfiler profiler##__LINE__(name)
+#define FORGE_PROFILE_CONCAT_INNER(a, b) a##b
+#define FORGE_PROFILE_CONCAT(a, b) FORGE_PROFILE_CONCAT_INNER(a, b)
+
+// Macro for easy profiling. The zone is registered the first time the line
+// runs; after that a scope costs two timestamps and one buffer write.
+#define PROFILE_SCOPE(name) \
+    static const ForgeEngine::Core::ProfileZone FORGE_PROFILE_CONCAT(profileZone, __LINE__)( \
+        name, __FILE__, __LINE__); \
+    ForgeEngine::Core::ScopedProfiler FORGE_PROFILE_CONCAT(profiler, __LINE__)( \
+        FORGE_PROFILE_CONCAT(profileZone, __LINE__))
+
+// Attributes allocations in the enclosing scope to `name` without timing it
+#define MEMORY_TAG(name) \
+    static const ForgeEngine::Core::ProfileZone FORGE_PROFILE_CONCAT(memoryZone, __LINE__)( \
+        name, __FILE__, __LINE__); \
+    ForgeEngine::Core::MemoryTag FORGE_PROFILE_CONCAT(memoryTag, __LINE__)( \
+        FORGE_PROFILE_CONCAT(memoryZone, __LINE__))
@@ -0,0 +1,398 @@
+#include "SamplingProfiler.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <spdlog/spdlog.h>
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <ucontext.h>
+#endif
+
+namespace ForgeEngine {
+namespace Core {
+
+#if defined(__linux__)
+
+namespace {
+
+struct Sample {
+    std::atomic<uint64_t> sequence;
+    uint32_t zone;
+    uint32_t depth;
+    uintptr_t frames[SamplingProfiler::MaxDepth];
+};
+
+// Bounded ring with per-slot sequence numbers. Signal handlers on any thread
+// push without locks; a single consumer at a time pops (see drainRing()).
+class SampleRing {
+public:
+    static constexpr uint64_t Capacity = 4096;
+
+    SampleRing() {
+        for (uint64_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Async-signal-safe; false when the ring is full
+    bool push(uint32_t zone, const uintptr_t* frames, uint32_t depth) {
+        uint64_t position = head.load(std::memory_order_relaxed);
+        Sample* slot;
+        while (true) {
+            slot = &slots[position % Capacity];
+            const uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+            if (difference == 0) {
+                if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+        slot->zone = zone;
+        slot->depth = depth;
+        std::copy(frames, frames + depth, slot->frames);
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename F>
+    bool pop(F&& consume) {
+        Sample& slot = slots[tail % Capacity];
+        if (slot.sequence.load(std::memory_order_acquire) != tail + 1) {
+            return false;
+        }
+        consume(slot);
+        slot.sequence.store(tail + Capacity, std::memory_order_release);
+        ++tail;
+        return true;
+    }
+
+private:
+    Sample slots[Capacity];
+    alignas(64) std::atomic<uint64_t> head{0};
+    alignas(64) uint64_t tail = 0;
+};
+
+// Shared with the signal handler
+std::atomic<bool> samplingActive{false};
+std::atomic<int> handlersInFlight{0};
+std::atomic<SampleRing*> sampleRing{nullptr};
+std::atomic<uint64_t> samplesTaken{0};
+std::atomic<uint64_t> samplesDropped{0};
+
+// Start/stop state, guarded by controlMutex
+std::mutex controlMutex;
+bool handlerInstalled = false;
+timer_t samplingTimer;
+std::thread collector;
+
+std::mutex collectorMutex;
+std::condition_variable collectorWake;
+bool collectorStop = false;
+
+// Folded samples: zone ID followed by the frames, leaf first
+std::mutex countsMutex;
+std::map<std::vector<uintptr_t>, uint64_t> stackCounts;
+
+// Loads the ring under countsMutex, which stop() holds to free it
+void drainRing() {
+    std::lock_guard<std::mutex> lock(countsMutex);
+    SampleRing* ring = sampleRing.load(std::memory_order_acquire);
+    if (!ring) {
+        return;
+    }
+    std::vector<uintptr_t> key;
+    while (ring->pop([&key](const Sample& sample) {
+        key.assign(1, sample.zone);
+        key.insert(key.end(), sample.frames, sample.frames + sample.depth);
+    })) {
+        ++stackCounts[key];
+    }
+}
+
+void collectLoop() {
+    std::unique_lock<std::mutex> lock(collectorMutex);
+    while (!collectorStop) {
+        collectorWake.wait_for(lock, std::chrono::milliseconds(20));
+        lock.unlock();
+        drainRing();
+        lock.lock();
+    }
+}
+
+std::string symbolize(uintptr_t address) {
+    std::string name;
+    Dl_info info{};
+    const bool found = dladdr(reinterpret_cast<void*>(address), &info) != 0;
+    if (found && info.dli_sname) {
+        int status = 0;
+        char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+        name = status == 0 && demangled ? demangled : info.dli_sname;
+        std::free(demangled);
+    } else if (found && info.dli_fname) {
+        // Not exported; module and offset still resolve with addr2line
+        const char* module = std::strrchr(info.dli_fname, '/');
+        name = fmt::format("{}+0x{:x}", module ? module + 1 : info.dli_fname,
+                           address - reinterpret_cast<uintptr_t>(info.dli_fbase));
+    } else {
+        name = fmt::format("0x{:x}", address);
+    }
+    // ';' separates frames in the collapsed format
+    std::replace(name.begin(), name.end(), ';', ':');
+    return name;
+}
+
+} // namespace
+
+uint32_t SamplingProfiler::captureStack(const void* context, uintptr_t* frames) {
+    const auto* machine = &static_cast<const ucontext_t*>(context)->uc_mcontext;
+#if defined(__x86_64__)
+    const uintptr_t pc = static_cast<uintptr_t>(machine->gregs[REG_RIP]);
+    uintptr_t fp = static_cast<uintptr_t>(machine->gregs[REG_RBP]);
+    const uintptr_t sp = static_cast<uintptr_t>(machine->gregs[REG_RSP]);
+#elif defined(__aarch64__)
+    const uintptr_t pc = static_cast<uintptr_t>(machine->pc);
+    uintptr_t fp = static_cast<uintptr_t>(machine->regs[29]);
+    const uintptr_t sp = static_cast<uintptr_t>(machine->sp);
+#else
+    (void)machine;
+    (void)frames;
+    return 0;
+#endif
+#if defined(__x86_64__) || defined(__aarch64__)
+    uint32_t depth = 0;
+    frames[depth++] = pc;
+
+    // Only follow frame pointers that stay inside this thread's stack and
+    // move towards its base; anything else is a register that isn't being
+    // used as a frame pointer
+    const StackBounds bounds = threadStack;
+    if (bounds.high == 0 || sp < bounds.low || sp >= bounds.high) {
+        return depth;
+    }
+    uintptr_t lowest = sp;
+    while (depth < MaxDepth && fp >= lowest && fp % sizeof(uintptr_t) == 0 &&
+           fp + 2 * sizeof(uintptr_t) <= bounds.high) {
+        const auto* frame = reinterpret_cast<const uintptr_t*>(fp);
+        const uintptr_t next = frame[0];
+        const uintptr_t returnAddress = frame[1];
+        if (returnAddress == 0) {
+            break;
+        }
+        frames[depth++] = returnAddress;
+        if (next <= fp) {
+            break;
+        }
+        lowest = fp;
+        fp = next;
+    }
+    return depth;
+#endif
+}
+
+void SamplingProfiler::handleSignal(int, siginfo_t*, void* context) {
+    const int savedErrno = errno;
+    // Counted before checking the flag, so stop() can wait for handlers that
+    // may still touch the ring
+    handlersInFlight.fetch_add(1);
+    if (samplingActive.load()) {
+        if (SampleRing* ring = sampleRing.load(std::memory_order_acquire)) {
+            uintptr_t frames[MaxDepth];
+            const uint32_t depth = captureStack(context, frames);
+            if (depth > 0 && ring->push(Profiler::currentZone(), frames, depth)) {
+                samplesTaken.fetch_add(1, std::memory_order_relaxed);
+            } else if (depth > 0) {
+                samplesDropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }
+    handlersInFlight.fetch_sub(1);
+    errno = savedErrno;
+}
+
+bool SamplingProfiler::start(int frequencyHz) {
+    std::lock_guard<std::mutex> lock(controlMutex);
+    if (samplingActive.load()) {
+        return false;
+    }
+    frequencyHz = std::clamp(frequencyHz, 1, 10000);
+    registerThread();
+
+    // Installed once and left in place: a SIGPROF still pending after stop()
+    // must not hit the default action, which terminates the process
+    if (!handlerInstalled) {
+        struct sigaction action;
+        std::memset(&action, 0, sizeof(action));
+        action.sa_sigaction = &SamplingProfiler::handleSignal;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        if (sigaction(SIGPROF, &action, nullptr) != 0) {
+            spdlog::warn("Sampling profiler: can't install SIGPROF handler: {}", std::strerror(errno));
+            return false;
+        }
+        handlerInstalled = true;
+    }
+
+    sigevent event;
+    std::memset(&event, 0, sizeof(event));
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = SIGPROF;
+    if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &event, &samplingTimer) != 0) {
+        spdlog::warn("Sampling profiler: can't create timer: {}", std::strerror(errno));
+        return false;
+    }
+
+    sampleRing.store(new SampleRing(), std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> collectorLock(collectorMutex);
+        collectorStop = false;
+    }
+    collector = std::thread(collectLoop);
+    samplingActive.store(true);
+
+    // The timer counts CPU time of the whole process, so busy threads are
+    // sampled in proportion to their load
+    const long interval = 1000000000L / frequencyHz;
+    itimerspec period;
+    period.it_interval.tv_sec = interval / 1000000000L;
+    period.it_interval.tv_nsec = interval % 1000000000L;
+    period.it_value = period.it_interval;
+    timer_settime(samplingTimer, 0, &period, nullptr);
+
+    spdlog::info("Sampling profiler started at {} Hz", frequencyHz);
+    return true;
+}
+
+void SamplingProfiler::stop() {
+    std::lock_guard<std::mutex> lock(controlMutex);
+    if (!samplingActive.load()) {
+        return;
+    }
+    timer_delete(samplingTimer);
+    samplingActive.store(false);
+    while (handlersInFlight.load() > 0) {
+        std::this_thread::yield();
+    }
+
+    {
+        std::lock_guard<std::mutex> collectorLock(collectorMutex);
+        collectorStop = true;
+    }
+    collectorWake.notify_one();
+    collector.join();
+
+    drainRing();
+    {
+        // writeCollapsed() and clear() drain without controlMutex
+        std::lock_guard<std::mutex> countsLock(countsMutex);
+        delete sampleRing.exchange(nullptr, std::memory_order_acq_rel);
+    }
+    spdlog::info("Sampling profiler stopped after {} samples ({} dropped)",
+                 samplesTaken.load(), samplesDropped.load());
+}
+
+bool SamplingProfiler::running() {
+    return samplingActive.load();
+}
+
+bool SamplingProfiler::writeCollapsed(const std::string& path) {
+    drainRing();
+    std::map<std::vector<uintptr_t>, uint64_t> stacks;
+    {
+        std::lock_guard<std::mutex> lock(countsMutex);
+        stacks = stackCounts;
+    }
+
+    // Root first; return addresses point past the call, so look up the
+    // instruction before them
+    std::unordered_map<uintptr_t, std::string> names;
+    std::map<std::string, uint64_t> folded;
+    for (const auto& [key, count] : stacks) {
+        std::string line = Profiler::getInstance().zoneName(static_cast<uint32_t>(key[0]));
+        for (size_t i = key.size() - 1; i >= 1; --i) {
+            const uintptr_t address = i == 1 ? key[i] : key[i] - 1;
+            auto it = names.find(address);
+            if (it == names.end()) {
+                it = names.emplace(address, symbolize(address)).first;
+            }
+            line += ';';
+            line += it->second;
+        }
+        folded[line] += count;
+    }
+
+    std::ofstream out(path);
+    if (!out) {
+        spdlog::error("Failed to write collapsed stacks to {}", path);
+        return false;
+    }
+    for (const auto& [stack, count] : folded) {
+        out << stack << ' ' << count << '\n';
+    }
+    return static_cast<bool>(out);
+}
+
+void SamplingProfiler::clear() {
+    drainRing();
+    std::lock_guard<std::mutex> lock(countsMutex);
+    stackCounts.clear();
+    samplesTaken.store(0);
+    samplesDropped.store(0);
+}
+
+uint64_t SamplingProfiler::sampleCount() {
+    return samplesTaken.load();
+}
+
+uint64_t SamplingProfiler::droppedSamples() {
+    return samplesDropped.load();
+}
+
+#else
+
+bool SamplingProfiler::start(int) {
+    spdlog::warn("Sampling profiler is only supported on Linux");
+    return false;
+}
+
+void SamplingProfiler::stop() {}
+
+bool SamplingProfiler::running() {
+    return false;
+}
+
+bool SamplingProfiler::writeCollapsed(const std::string&) {
+    return false;
+}
+
+void SamplingProfiler::clear() {}
+
+uint64_t SamplingProfiler::sampleCount() {
+    return 0;
+}
+
+uint64_t SamplingProfiler::droppedSamples() {
+    return 0;
+}
+
+#endif
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -0,0 +1,89 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#if defined(__linux__)
+#include <csignal>
+#include <pthread.h>
+#endif
+
+namespace ForgeEngine {
+namespace Core {
+
+// Statistical CPU profiler for long headless runs. While running, a
+// process-wide CPU-time timer raises SIGPROF at the given frequency; the
+// signal handler walks the interrupted thread's frame pointers and pushes the
+// stack into a lock-free ring, which a collector thread folds into per-stack
+// counts. Samples land on threads in proportion to the CPU they burn, and
+// each stack is rooted at the profiler zone that was current on that thread.
+//
+// writeCollapsed() symbolizes the stacks and writes them in the collapsed
+// "frame;frame;frame count" format read by flamegraph.pl, speedscope and
+// similar tools.
+//
+// Stacks are only complete for code built with frame pointers (the
+// FORGE_FRAME_POINTERS build option) and on threads that called
+// registerThread(); other threads contribute just the interrupted function.
+// The kernel checks process CPU timers on its scheduler tick, so the
+// effective rate is capped at CONFIG_HZ (often 250 Hz) per busy CPU.
+//
+// When stopped there is no timer, no collector thread and no buffer, so an
+// idle profiler costs nothing. Linux only; start() fails elsewhere.
+class SamplingProfiler {
+public:
+    static constexpr size_t MaxDepth = 64;
+
+    // Starts sampling; false if already running or unsupported
+    static bool start(int frequencyHz = 999);
+
+    // Stops sampling. Samples collected so far are kept for writeCollapsed().
+    static void stop();
+
+    static bool running();
+
+    // Writes every sample since the last clear() as collapsed stacks.
+    // Returns false if the file can't be written.
+    static bool writeCollapsed(const std::string& path);
+
+    static void clear();
+
+    static uint64_t sampleCount();
+
+    // Samples lost because the ring was full
+    static uint64_t droppedSamples();
+
+    // Records the calling thread's stack bounds so the signal handler can
+    // walk past its leaf frame safely. ThreadPool workers and the thread
+    // calling start() register themselves.
+    static void registerThread() {
+#if defined(__linux__)
+        pthread_attr_t attributes;
+        if (pthread_getattr_np(pthread_self(), &attributes) != 0) {
+            return;
+        }
+        void* stackAddress = nullptr;
+        size_t stackSize = 0;
+        if (pthread_attr_getstack(&attributes, &stackAddress, &stackSize) == 0) {
+            threadStack.low = reinterpret_cast<uintptr_t>(stackAddress);
+            threadStack.high = threadStack.low + stackSize;
+        }
+        pthread_attr_destroy(&attributes);
+#endif
+    }
+
+private:
+    struct StackBounds {
+        uintptr_t low;
+        uintptr_t high;  // 0 until registerThread()
+    };
+
+    // Read from the signal handler; zero-initialized, so safe there
+    inline static thread_local StackBounds threadStack{};
+
+#if defined(__linux__)
+    static void handleSignal(int signal, siginfo_t* info, void* context);
+    static uint32_t captureStack(const void* context, uintptr_t* frames);
+#endif
+};
+
+} // namespace Core
+} // namespace ForgeEngine
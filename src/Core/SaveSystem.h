@@ -2,6 +2,7 @@
 #include <filesystem>
 #include <fstream>
 #include <nlohmann/json.hpp>
+#include "CoroutineScheduler.h"
 #include "../GameSystems/MultiVillageSystem.h"
 #include "../GameSystems/TechnologySystem.h"
 #include "../GameSystems/EnvironmentalSystem.h"
@@ -56,6 +57,46 @@ public:
         }
     }
 
+    // Coroutine version of saveGame() that spreads the work over several
+    // frames: one section is serialized per frame, between system updates,
+    // and the file is written on a worker thread. Sections therefore reflect
+    // consecutive frames rather than a single instant.
+    ForgeEngine::Core::Task<bool> saveGameAsync(
+        ForgeEngine::Core::CoroutineScheduler& scheduler,
+        std::string saveName
+    ) {
+        try {
+            nlohmann::json saveData;
+
+            saveData["metadata"] = {
+                {"version", "1.0.0"},
+                {"timestamp", std::time(nullptr)},
+                {"saveName", saveName}
+            };
+
+            co_await scheduler.nextFrame();
+            saveData["villages"] = serializeVillages();
+            co_await scheduler.nextFrame();
+            saveData["technology"] = serializeTechnology();
+            co_await scheduler.nextFrame();
+            saveData["environment"] = serializeEnvironment();
+            co_await scheduler.nextFrame();
+            saveData["stories"] = serializeStories();
+
+            // Formatting and disk I/O don't touch the simulation
+            co_await scheduler.schedule(ForgeEngine::Core::TaskPriority::Background);
+            PROFILE_SCOPE("SaveSystem_WriteSaveFile");
+            std::ofstream file(getSavePath(saveName));
+            file << saveData.dump(4);
+
+            co_return true;
+        }
+        catch (const std::exception& e) {
+            // Log error
+            co_return false;
+        }
+    }
+
     bool loadGame(const std::string& saveName) {
         PROFILE_SCOPE("SaveSystem_LoadGame");
 
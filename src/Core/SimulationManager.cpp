@@ -1,6 +1,7 @@
 #include "SimulationManager.h"
 #include <stdexcept>
 #include <chrono>
+#include <filesystem>
 
 namespace Forge {
 
@@ -10,13 +11,60 @@ SimulationManager& SimulationManager::GetInstance() {
 }
 
 SimulationManager::SimulationManager() : 
-    m_populationManager(std::make_unique<PopulationManager>(100)),
-    m_economicSystem(std::make_unique<VillageEconomy>(100)),
+    m_threadPool(std::make_shared<ForgeEngine::Core::ThreadPool>()),
+    m_populationManager(std::make_unique<PopulationManager>(100, m_threadPool)),
+    m_economicSystem(std::make_unique<VillageEconomy>(100, m_threadPool)),
     m_scriptEngine(std::make_unique<ScriptEngine>()),
     m_storyEngine(std::make_unique<StoryEngine>()),
-    m_currentState(SimulationState::Stopped) {}
+    m_systemScheduler(m_threadPool),
+    m_coroutineScheduler(m_threadPool),
+    m_currentState(SimulationState::Stopped) {
+    // Population and economy are independent and run side by side; story
+    // generation reads both, so it waits for them. Births and deaths resize
+    // the needs arrays, so population runs after the needs kernel.
+    m_systemScheduler.addSystem({
+        "NPCNeeds", {}, {"Needs"},
+        [this](float dt) { NPCNeedsStorage::shared().advance(dt, m_threadPool.get()); }
+    });
+    m_systemScheduler.addSystem({
+        "Population", {}, {"Population", "Needs"},
+        [this](float dt) { UpdatePopulation(dt); }
+    });
+    m_systemScheduler.addSystem({
+        "Economy", {}, {"Economy"},
+        [this](float dt) { UpdateEconomy(dt); }
+    });
+    m_systemScheduler.addSystem({
+        "StoryGeneration", {"Population", "Economy"}, {"Stories"},
+        [this](float dt) { UpdateStoryGeneration(dt); }
+    });
+
+    // Every third overrun of a system raises an event. The flight recorder
+    // copies every tick's events, so it only keeps (and on overrun dumps)
+    // the last 120 ticks when built with FORGE_FLIGHT_RECORDER.
+#ifdef FORGE_FLIGHT_RECORDER
+    constexpr size_t recorderFrames = 120;
+#else
+    constexpr size_t recorderFrames = 0;
+#endif
+    ForgeEngine::Core::Profiler::getInstance().setOverrunHandler(
+        [this](const ForgeEngine::Core::Profiler::BudgetOverrun& overrun) {
+            TriggerSimulationEvent("FrameBudgetOverrun: " + overrun.zone);
+        },
+        3, recorderFrames, "profiles/");
+
+    // Starting budgets; tune per target hardware
+    SetSystemBudget("NPCNeeds", 1.0f);
+    SetSystemBudget("Population", 4.0f);
+    SetSystemBudget("Economy", 2.0f);
+    SetSystemBudget("StoryGeneration", 2.0f);
+}
 
-SimulationManager::~SimulationManager() = default;
+SimulationManager::~SimulationManager() {
+    // The profiler outlives us; its handler must not call back into a
+    // destroyed manager
+    ForgeEngine::Core::Profiler::getInstance().setOverrunHandler(nullptr);
+}
 
 void SimulationManager::StartSimulation() {
     if (m_currentState != SimulationState::Running) {
@@ -51,13 +99,42 @@ void SimulationManager::UpdateSimulationSystems(float deltaTime) {
     if (m_currentState != SimulationState::Running) return;
 
     try {
-        UpdatePopulation(deltaTime);
-        UpdateEconomy(deltaTime);
-        UpdateStoryGeneration(deltaTime);
+        // Resume coroutines waiting on this frame before the systems run
+        m_coroutineScheduler.advanceFrame(deltaTime);
+        m_systemScheduler.run(deltaTime);
     } catch (const std::exception& e) {
         // Log error and potentially trigger error event
         TriggerSimulationEvent("SimulationError: " + std::string(e.what()));
     }
+
+    ForgeEngine::Core::Profiler::getInstance().endFrame();
+    ForgeEngine::Core::AllocationTracker::endFrame();
+    ForgeEngine::Core::FrameArena::endFrame();
+}
+
+void SimulationManager::SetSystemBudget(const std::string& systemName, float milliseconds) {
+    ForgeEngine::Core::Profiler::getInstance().setBudget(systemName, milliseconds);
+}
+
+bool SimulationManager::StartSamplingProfiler(int frequencyHz) {
+    ForgeEngine::Core::SamplingProfiler::clear();
+    return ForgeEngine::Core::SamplingProfiler::start(frequencyHz);
+}
+
+void SimulationManager::StopSamplingProfiler(const std::string& outputPath) {
+    if (!ForgeEngine::Core::SamplingProfiler::running()) {
+        return;
+    }
+    ForgeEngine::Core::SamplingProfiler::stop();
+
+    const std::filesystem::path directory = std::filesystem::path(outputPath).parent_path();
+    std::error_code error;
+    if (!directory.empty()) {
+        std::filesystem::create_directories(directory, error);
+    }
+    if (ForgeEngine::Core::SamplingProfiler::writeCollapsed(outputPath)) {
+        TriggerSimulationEvent("SamplingProfileWritten: " + outputPath);
+    }
 }
 
 void SimulationManager::RegisterSimulationEventHandler(
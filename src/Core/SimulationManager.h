@@ -3,6 +3,12 @@
 #include "../GameSystems/PopulationDynamics.h"
 #include "../GameSystems/EconomicSystem.h"
 #include "../Core/ScriptEngine.h"
+#include "../Core/AllocationTracker.h"
+#include "../Core/FrameArena.h"
+#include "../Core/SamplingProfiler.h"
+#include "../Core/ThreadPool.h"
+#include "../Core/SystemScheduler.h"
+#include "../Core/CoroutineScheduler.h"
 #include <memory>
 #include <vector>
 #include <functional>
@@ -23,6 +29,21 @@ public:
     // System Coordination
     void UpdateSimulationSystems(float deltaTime);
 
+    // Multi-frame work (saving, world generation, model loading) runs as
+    // coroutines driven by this scheduler, which ticks once per update
+    ForgeEngine::Core::CoroutineScheduler& GetCoroutineScheduler() { return m_coroutineScheduler; }
+
+    // Real time a scheduled system may take per tick. Repeated overruns raise
+    // a "FrameBudgetOverrun: <system>" simulation event; with
+    // FORGE_FLIGHT_RECORDER they also dump the last frames of profiler
+    // events to profiles/.
+    void SetSystemBudget(const std::string& systemName, float milliseconds);
+
+    // CPU sampling profiler for long runs; writes flame-graph-ready collapsed
+    // stacks to outputPath when stopped. Free while not running.
+    bool StartSamplingProfiler(int frequencyHz = 999);
+    void StopSamplingProfiler(const std::string& outputPath = "profiles/samples.folded");
+
     // Event and Callback Management
     void RegisterSimulationEventHandler(std::function<void(const std::string&)> handler);
     void TriggerSimulationEvent(const std::string& eventName);
@@ -39,12 +60,19 @@ private:
     SimulationManager(const SimulationManager&) = delete;
     SimulationManager& operator=(const SimulationManager&) = delete;
 
+    // Shared by the simulation systems for their data-parallel loops
+    std::shared_ptr<ForgeEngine::Core::ThreadPool> m_threadPool;
+
     // Simulation Systems
     std::unique_ptr<PopulationManager> m_populationManager;
     std::unique_ptr<VillageEconomy> m_economicSystem;
     std::unique_ptr<ScriptEngine> m_scriptEngine;
     std::unique_ptr<StoryEngine> m_storyEngine;
 
+    // Runs the per-frame updates below as a dependency graph
+    ForgeEngine::Core::SystemScheduler m_systemScheduler;
+    ForgeEngine::Core::CoroutineScheduler m_coroutineScheduler;
+
     // Simulation State
     enum class SimulationState {
         Stopped,
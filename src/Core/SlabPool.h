@@ -0,0 +1,222 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ForgeEngine {
+namespace Core {
+
+// Reference to an object in a SlabPool: a 32-bit slot index plus the 32-bit
+// generation the slot had when the object was created. Releasing the object
+// bumps the slot's generation, so every outstanding handle to it goes stale
+// instead of dangling.
+template<typename T>
+struct SlabHandle {
+    static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+
+    explicit operator bool() const { return index != InvalidIndex; }
+    bool operator==(const SlabHandle&) const = default;
+};
+
+// Pool that keeps its live objects packed at the front of a sequence of
+// fixed-size pages, so loops over every object stream through contiguous
+// memory. Objects are reached through generational handles that are checked
+// on every access; create() and release() are O(1), release() moving the
+// last object into the freed place. Pointers and references are therefore
+// only valid until the next release(); keep handles instead. Pages are never
+// reallocated, so create() never moves existing objects.
+//
+// Not thread-safe; give each system its own pool or guard it externally.
+template<typename T, size_t PageSize = 256>
+class SlabPool {
+public:
+    using Handle = SlabHandle<T>;
+
+    SlabPool() = default;
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    ~SlabPool() {
+        clear();
+    }
+
+    template<typename... Args>
+    Handle create(Args&&... args) {
+        const size_t denseIndex = count;
+        if (denseIndex == pages.size() * PageSize) {
+            pages.push_back(std::make_unique<Page>());
+        }
+
+        uint32_t slot;
+        if (freeSlot != Handle::InvalidIndex) {
+            slot = freeSlot;
+        } else {
+            if (slots.size() == Handle::InvalidIndex) {
+                throw std::runtime_error("SlabPool is full");
+            }
+            slot = static_cast<uint32_t>(slots.size());
+            slots.push_back(Slot{});
+        }
+        denseSlots.push_back(slot);
+        try {
+            new (slotAddress(denseIndex)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            denseSlots.pop_back();
+            if (slot != freeSlot) {
+                slots.pop_back();
+            }
+            throw;
+        }
+
+        if (slot == freeSlot) {
+            freeSlot = slots[slot].nextFree;
+        }
+        slots[slot].denseIndex = static_cast<uint32_t>(denseIndex);
+        ++count;
+        return Handle{slot, slots[slot].generation};
+    }
+
+    // Destroys the object; false if the handle was already stale
+    bool release(Handle handle) {
+        if (!contains(handle)) {
+            return false;
+        }
+        Slot& slot = slots[handle.index];
+        const size_t denseIndex = slot.denseIndex;
+        const size_t last = count - 1;
+
+        // Keep the live range packed by moving the last object into the hole
+        if (denseIndex != last) {
+            *slotAddress(denseIndex) = std::move(*slotAddress(last));
+            denseSlots[denseIndex] = denseSlots[last];
+            slots[denseSlots[denseIndex]].denseIndex = static_cast<uint32_t>(denseIndex);
+        }
+        std::destroy_at(slotAddress(last));
+        denseSlots.pop_back();
+        --count;
+
+        ++slot.generation;
+        slot.denseIndex = Handle::InvalidIndex;
+        slot.nextFree = freeSlot;
+        freeSlot = handle.index;
+        return true;
+    }
+
+    bool contains(Handle handle) const {
+        return handle.index < slots.size() && slots[handle.index].generation == handle.generation;
+    }
+
+    // nullptr if the handle is stale
+    T* get(Handle handle) {
+        return contains(handle) ? slotAddress(slots[handle.index].denseIndex) : nullptr;
+    }
+
+    const T* get(Handle handle) const {
+        return contains(handle) ? slotAddress(slots[handle.index].denseIndex) : nullptr;
+    }
+
+    T& at(Handle handle) {
+        if (T* object = get(handle)) {
+            return *object;
+        }
+        throw std::runtime_error("Stale or invalid SlabPool handle");
+    }
+
+    const T& at(Handle handle) const {
+        if (const T* object = get(handle)) {
+            return *object;
+        }
+        throw std::runtime_error("Stale or invalid SlabPool handle");
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return pages.size() * PageSize; }
+
+    // Live objects in the given page, packed; the last page may be partial.
+    // Suited to handing whole pages to ThreadPool::parallelFor.
+    size_t pageCount() const { return (count + PageSize - 1) / PageSize; }
+
+    std::span<T> page(size_t pageIndex) {
+        const size_t first = pageIndex * PageSize;
+        return {slotAddress(first), std::min(PageSize, count - first)};
+    }
+
+    std::span<const T> page(size_t pageIndex) const {
+        const size_t first = pageIndex * PageSize;
+        return {slotAddress(first), std::min(PageSize, count - first)};
+    }
+
+    // Calls f(object) for every live object, page by page
+    template<typename F>
+    void forEach(F&& f) {
+        for (size_t p = 0; p < pageCount(); ++p) {
+            for (T& object : page(p)) {
+                f(object);
+            }
+        }
+    }
+
+    // Calls f(handle, object) for every live object
+    template<typename F>
+    void forEachWithHandle(F&& f) {
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t slot = denseSlots[i];
+            f(Handle{slot, slots[slot].generation}, *slotAddress(i));
+        }
+    }
+
+    // Handle of the object at a position in iteration order
+    Handle handleAt(size_t denseIndex) const {
+        const uint32_t slot = denseSlots[denseIndex];
+        return Handle{slot, slots[slot].generation};
+    }
+
+    // Destroys every object; all outstanding handles go stale. Pages are kept.
+    void clear() {
+        while (count > 0) {
+            release(handleAt(count - 1));
+        }
+    }
+
+private:
+    struct Page {
+        alignas(T) std::byte storage[sizeof(T) * PageSize];
+    };
+
+    struct Slot {
+        uint32_t denseIndex = Handle::InvalidIndex;
+        uint32_t generation = 0;
+        uint32_t nextFree = Handle::InvalidIndex;
+    };
+
+    std::vector<std::unique_ptr<Page>> pages;
+    std::vector<Slot> slots;            // indexed by handle
+    std::vector<uint32_t> denseSlots;   // dense index -> slot
+    uint32_t freeSlot = Handle::InvalidIndex;
+    size_t count = 0;
+
+    T* slotAddress(size_t denseIndex) {
+        return std::launder(reinterpret_cast<T*>(
+            pages[denseIndex / PageSize]->storage + denseIndex % PageSize * sizeof(T)));
+    }
+
+    const T* slotAddress(size_t denseIndex) const {
+        return std::launder(reinterpret_cast<const T*>(
+            pages[denseIndex / PageSize]->storage + denseIndex % PageSize * sizeof(T)));
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
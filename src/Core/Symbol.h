@@ -0,0 +1,119 @@
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ForgeEngine {
+namespace Core {
+
+// Process-wide table of interned strings. Each distinct string gets a dense
+// 32-bit ID the first time it is interned and keeps it for the life of the
+// process; ID 0 is the empty string. Thread-safe: lookups of known strings
+// take a shared lock, only new strings take the exclusive one.
+class SymbolTable {
+public:
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    static SymbolTable& global() {
+        static SymbolTable table;
+        return table;
+    }
+
+    uint32_t intern(std::string_view text) {
+        {
+            std::shared_lock lock(mutex);
+            auto it = ids.find(text);
+            if (it != ids.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock lock(mutex);
+        // Another thread may have interned it between the two locks
+        auto it = ids.find(text);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        const auto id = static_cast<uint32_t>(texts.size());
+        // deque elements never move, so the views in ids stay valid
+        ids.emplace(texts.emplace_back(text), id);
+        return id;
+    }
+
+    // ID of text if it was ever interned, otherwise 0
+    uint32_t find(std::string_view text) const {
+        std::shared_lock lock(mutex);
+        auto it = ids.find(text);
+        return it != ids.end() ? it->second : 0;
+    }
+
+    // Interned strings are never freed, so the view stays valid
+    std::string_view text(uint32_t id) const {
+        std::shared_lock lock(mutex);
+        return id < texts.size() ? std::string_view(texts[id]) : std::string_view();
+    }
+
+    size_t size() const {
+        std::shared_lock lock(mutex);
+        return texts.size();
+    }
+
+private:
+    SymbolTable() {
+        texts.emplace_back();
+        ids.emplace(texts.front(), 0);
+    }
+
+    std::deque<std::string> texts;      // indexed by ID
+    std::unordered_map<std::string_view, uint32_t> ids;
+    mutable std::shared_mutex mutex;
+};
+
+// Interned name of a technology, skill, profession, event or the like.
+// Comparing and hashing compare the 32-bit ID, never the characters.
+// Constructing one from text interns it, which hashes and locks; do that at
+// load, script and UI boundaries and keep Symbols everywhere else.
+class Symbol {
+public:
+    constexpr Symbol() = default;
+
+    explicit Symbol(std::string_view text)
+        : m_id(SymbolTable::global().intern(text)) {}
+
+    // The symbol for text if it has been interned, the empty symbol
+    // otherwise; never grows the table
+    static Symbol find(std::string_view text) {
+        Symbol symbol;
+        symbol.m_id = SymbolTable::global().find(text);
+        return symbol;
+    }
+
+    uint32_t id() const { return m_id; }
+    std::string_view view() const { return SymbolTable::global().text(m_id); }
+    std::string str() const { return std::string(view()); }
+    bool empty() const { return m_id == 0; }
+
+    friend bool operator==(Symbol, Symbol) = default;
+    // Orders by ID, i.e. by first interning, not alphabetically
+    friend std::strong_ordering operator<=>(Symbol, Symbol) = default;
+
+private:
+    uint32_t m_id = 0;
+};
+
+} // namespace Core
+} // namespace ForgeEngine
+
+template<>
+struct std::hash<ForgeEngine::Core::Symbol> {
+    size_t operator()(ForgeEngine::Core::Symbol symbol) const noexcept {
+        return symbol.id();
+    }
+};
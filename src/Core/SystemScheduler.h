@@ -0,0 +1,199 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Profiler.h"
+#include "ThreadPool.h"
+
+namespace ForgeEngine {
+namespace Core {
+
+// Declaration of one per-frame system: what it reads, what it writes and how
+// to update it. Reads and writes name shared components or resources.
+struct SystemDesc {
+    std::string name;
+    std::vector<std::string> reads;
+    std::vector<std::string> writes;
+    std::function<void(float)> update;
+};
+
+// Runs a set of systems once per frame as a dependency graph. Two systems
+// conflict when one writes something the other reads or writes; conflicting
+// systems run in registration order, everything else runs concurrently on
+// the thread pool. The graph is rebuilt whenever the set of enabled systems
+// changes, so frame time tends towards the critical path rather than the sum.
+// Each system is profiled as a zone with its own name, so frame budgets can
+// be set per system.
+class SystemScheduler {
+public:
+    explicit SystemScheduler(std::shared_ptr<ThreadPool> threadPool = nullptr)
+        : m_threadPool(std::move(threadPool)) {}
+
+    void addSystem(SystemDesc system) {
+        std::sort(system.reads.begin(), system.reads.end());
+        std::sort(system.writes.begin(), system.writes.end());
+        m_zones.push_back(Profiler::getInstance().internZone(system.name));
+        m_systems.push_back(std::move(system));
+        m_enabled.push_back(true);
+        m_dirty = true;
+    }
+
+    void setSystemEnabled(const std::string& name, bool enabled) {
+        for (size_t i = 0; i < m_systems.size(); ++i) {
+            if (m_systems[i].name == name && m_enabled[i] != enabled) {
+                m_enabled[i] = enabled;
+                m_dirty = true;
+            }
+        }
+    }
+
+    // Runs every enabled system once and returns when all have finished.
+    // The first exception thrown by a system is rethrown here; once a system
+    // has thrown, systems that have not started yet are skipped.
+    void run(float deltaTime) {
+        if (m_dirty) {
+            rebuildGraph();
+        }
+        if (m_nodes.empty()) {
+            return;
+        }
+
+        if (!m_threadPool) {
+            for (const auto& node : m_nodes) {
+                ScopedProfiler profiler(m_zones[node.system]);
+                m_systems[node.system].update(deltaTime);
+            }
+            return;
+        }
+
+        FrameContext frame;
+        frame.deltaTime = deltaTime;
+        frame.unfinished.store(m_nodes.size());
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            m_remaining[i].store(m_nodes[i].dependencyCount, std::memory_order_relaxed);
+        }
+
+        for (size_t i = 0; i < m_nodes.size(); ++i) {
+            if (m_nodes[i].dependencyCount == 0) {
+                launch(frame, i);
+            }
+        }
+
+        while (frame.unfinished.load(std::memory_order_acquire) > 0) {
+            if (!m_threadPool->tryRunPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (frame.error) {
+            std::rethrow_exception(frame.error);
+        }
+    }
+
+    size_t systemCount() const {
+        return m_systems.size();
+    }
+
+private:
+    struct Node {
+        size_t system;
+        size_t dependencyCount = 0;
+        std::vector<size_t> successors;
+    };
+
+    struct FrameContext {
+        float deltaTime = 0.0f;
+        std::atomic<size_t> unfinished{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+    };
+
+    std::shared_ptr<ThreadPool> m_threadPool;
+    std::vector<SystemDesc> m_systems;
+    std::vector<uint32_t> m_zones;
+    std::vector<bool> m_enabled;
+    std::vector<Node> m_nodes;
+    std::unique_ptr<std::atomic<size_t>[]> m_remaining;
+    bool m_dirty = true;
+
+    static bool intersects(const std::vector<std::string>& a, const std::vector<std::string>& b) {
+        auto itA = a.begin();
+        auto itB = b.begin();
+        while (itA != a.end() && itB != b.end()) {
+            if (*itA < *itB) {
+                ++itA;
+            } else if (*itB < *itA) {
+                ++itB;
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool conflicts(const SystemDesc& first, const SystemDesc& second) {
+        return intersects(first.writes, second.writes) ||
+               intersects(first.writes, second.reads) ||
+               intersects(first.reads, second.writes);
+    }
+
+    void rebuildGraph() {
+        m_nodes.clear();
+        for (size_t i = 0; i < m_systems.size(); ++i) {
+            if (m_enabled[i]) {
+                m_nodes.push_back(Node{i, 0, {}});
+            }
+        }
+
+        // Edges always point from the earlier registered system to the later
+        // one, which keeps the ordering deterministic and the graph acyclic
+        for (size_t later = 0; later < m_nodes.size(); ++later) {
+            for (size_t earlier = 0; earlier < later; ++earlier) {
+                if (conflicts(m_systems[m_nodes[earlier].system], m_systems[m_nodes[later].system])) {
+                    m_nodes[earlier].successors.push_back(later);
+                    ++m_nodes[later].dependencyCount;
+                }
+            }
+        }
+
+        m_remaining = std::make_unique<std::atomic<size_t>[]>(m_nodes.size());
+        m_dirty = false;
+    }
+
+    void launch(FrameContext& frame, size_t index) {
+        m_threadPool->post(TaskPriority::FrameCritical, [this, &frame, index]() {
+            execute(frame, index);
+        });
+    }
+
+    void execute(FrameContext& frame, size_t index) {
+        if (!frame.failed.load(std::memory_order_relaxed)) {
+            try {
+                const size_t system = m_nodes[index].system;
+                ScopedProfiler profiler(m_zones[system]);
+                m_systems[system].update(frame.deltaTime);
+            } catch (...) {
+                if (!frame.failed.exchange(true)) {
+                    frame.error = std::current_exception();
+                }
+            }
+        }
+
+        for (size_t successor : m_nodes[index].successors) {
+            if (m_remaining[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                launch(frame, successor);
+            }
+        }
+
+        // Last touch of the frame context; run() may return after this
+        frame.unfinished.fetch_sub(1, std::memory_order_release);
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -0,0 +1,113 @@
+#pragma once
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ForgeEngine {
+namespace Core {
+
+// Move-only replacement for std::function<void()> used by the ThreadPool.
+// Closures up to InlineSize bytes are stored in place, so posting a typical
+// [this, deltaTime] lambda never touches the heap. Larger closures fall back
+// to a single heap allocation.
+class TaskFunction {
+public:
+    static constexpr size_t InlineSize = 48;
+
+    TaskFunction() noexcept = default;
+
+    template<typename F,
+             typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, TaskFunction>>>
+    TaskFunction(F&& f) {
+        using Fn = std::decay_t<F>;
+        if constexpr (storedInline<Fn>) {
+            ::new (static_cast<void*>(storage)) Fn(std::forward<F>(f));
+            ops = &inlineOps<Fn>;
+        } else {
+            ::new (static_cast<void*>(storage)) Fn*(new Fn(std::forward<F>(f)));
+            ops = &heapOps<Fn>;
+        }
+    }
+
+    TaskFunction(TaskFunction&& other) noexcept {
+        moveFrom(other);
+    }
+
+    TaskFunction& operator=(TaskFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    TaskFunction(const TaskFunction&) = delete;
+    TaskFunction& operator=(const TaskFunction&) = delete;
+
+    ~TaskFunction() {
+        reset();
+    }
+
+    void operator()() {
+        ops->invoke(storage);
+    }
+
+    explicit operator bool() const noexcept {
+        return ops != nullptr;
+    }
+
+    void reset() noexcept {
+        if (ops) {
+            ops->destroy(storage);
+            ops = nullptr;
+        }
+    }
+
+private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        void (*move)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template<typename Fn>
+    static constexpr bool storedInline =
+        sizeof(Fn) <= InlineSize &&
+        alignof(Fn) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<Fn>;
+
+    template<typename Fn>
+    static constexpr Ops inlineOps{
+        [](void* s) { (*std::launder(static_cast<Fn*>(s)))(); },
+        [](void* dst, void* src) noexcept {
+            Fn* from = std::launder(static_cast<Fn*>(src));
+            ::new (dst) Fn(std::move(*from));
+            from->~Fn();
+        },
+        [](void* s) noexcept { std::launder(static_cast<Fn*>(s))->~Fn(); }
+    };
+
+    template<typename Fn>
+    static constexpr Ops heapOps{
+        [](void* s) { (**std::launder(static_cast<Fn**>(s)))(); },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) Fn*(*std::launder(static_cast<Fn**>(src)));
+        },
+        [](void* s) noexcept { delete *std::launder(static_cast<Fn**>(s)); }
+    };
+
+    void moveFrom(TaskFunction& other) noexcept {
+        if (other.ops) {
+            other.ops->move(storage, other.storage);
+            ops = other.ops;
+            other.ops = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage[InlineSize];
+    const Ops* ops = nullptr;
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -0,0 +1,81 @@
+#pragma once
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <utility>
+#include "ThreadPool.h"
+
+namespace ForgeEngine {
+namespace Core {
+
+// Fan-out/join helper for work that has to finish within the current frame.
+// Tasks are posted to the pool, frame-critical unless told otherwise;
+// wait() returns once all of them have run, executing queued pool tasks on
+// the waiting thread in the meantime. The destructor also waits, so a group
+// can never outlive the state its tasks capture by reference.
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& threadPool, TaskPriority taskPriority = TaskPriority::FrameCritical)
+        : pool(threadPool), priority(taskPriority) {}
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    ~TaskGroup() {
+        join();
+    }
+
+    template<class F>
+    void run(F&& task) {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        try {
+            pool.post(priority, [this, task = std::forward<F>(task)]() mutable {
+                try {
+                    task();
+                } catch (...) {
+                    if (!failed.exchange(true)) {
+                        error = std::current_exception();
+                    }
+                }
+                // Last touch of the group; wait() may return after this
+                pending.fetch_sub(1, std::memory_order_release);
+            });
+        } catch (...) {
+            // Never queued, e.g. the pool is shutting down; nothing else
+            // would count it down and join() would spin forever
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            throw;
+        }
+    }
+
+    // Blocks until every task run so far has finished, then rethrows the
+    // first exception any of them threw.
+    void wait() {
+        join();
+        if (failed.exchange(false)) {
+            std::rethrow_exception(std::exchange(error, nullptr));
+        }
+    }
+
+    size_t pendingCount() const {
+        return pending.load(std::memory_order_relaxed);
+    }
+
+private:
+    ThreadPool& pool;
+    TaskPriority priority;
+    std::atomic<size_t> pending{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+
+    void join() {
+        while (pending.load(std::memory_order_acquire) > 0) {
+            if (!pool.tryRunPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -1,47 +1,70 @@
 #pragma once
 #include <vector>
-#include <queue>
 #include <thread>
 #include <mutex>
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <future>
 #include <memory>
+#include <stdexcept>
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <type_traits>
 #include "Profiler.h"
+#include "SamplingProfiler.h"
+#include "TaskFunction.h"
+#include "WorkStealingQueue.h"
 
 namespace ForgeEngine {
 namespace Core {
 
+// Scheduling class of a pool task. Workers always take frame-critical work
+// before normal work and normal work before background work.
+enum class TaskPriority : size_t {
+    FrameCritical,  // per-frame system updates; the tick waits on these
+    Normal,
+    Background      // autosave, hot-reload scans, story generation, ...
+};
+
+// Work-stealing thread pool. Every worker owns one deque per priority lane:
+// tasks enqueued from a worker go to that worker's deque and are popped LIFO,
+// idle workers steal FIFO from the others. Tasks enqueued from outside the
+// pool are spread round-robin over the worker deques, so no single lock is
+// shared by everyone. Lanes are drained strictly in priority order; long
+// background tasks should call yieldToHigherPriority() at safe points so
+// frame-critical work isn't stuck behind them.
 class ThreadPool {
 public:
+    static constexpr size_t LaneCount = 3;
+
     ThreadPool(size_t numThreads = std::thread::hardware_concurrency()) {
+        if (numThreads == 0) {
+            numThreads = 1;
+        }
+
+        for (auto& lane : queues) {
+            lane.reserve(numThreads);
+            for (size_t i = 0; i < numThreads; ++i) {
+                lane.push_back(std::make_unique<WorkStealingQueue<Task>>());
+            }
+        }
+
+        workers.reserve(numThreads);
         for (size_t i = 0; i < numThreads; ++i) {
-            workers.emplace_back([this] {
-                while (true) {
-                    std::function<void()> task;
-                    {
-                        std::unique_lock<std::mutex> lock(queueMutex);
-                        condition.wait(lock, [this] {
-                            return this->stop || !this->tasks.empty();
-                        });
-
-                        if (this->stop && this->tasks.empty()) {
-                            return;
-                        }
-
-                        task = std::move(this->tasks.front());
-                        this->tasks.pop();
-                    }
-                    
-                    PROFILE_SCOPE("ThreadPool_TaskExecution");
-                    task();
-                }
-            });
+            workers.emplace_back([this, i] { workerLoop(i); });
         }
     }
 
     template<class F, class... Args>
-    auto enqueue(F&& f, Args&&... args) 
+    auto enqueue(F&& f, Args&&... args)
+        -> std::future<typename std::invoke_result<F, Args...>::type> {
+        return enqueue(TaskPriority::Normal, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    template<class F, class... Args>
+    auto enqueue(TaskPriority priority, F&& f, Args&&... args)
         -> std::future<typename std::invoke_result<F, Args...>::type> {
         using return_type = typename std::invoke_result<F, Args...>::type;
 
@@ -50,21 +73,154 @@ public:
         );
 
         std::future<return_type> res = task->get_future();
-        {
-            std::unique_lock<std::mutex> lock(queueMutex);
-            if (stop) {
-                throw std::runtime_error("Cannot enqueue on stopped ThreadPool");
+        if (stop.load()) {
+            throw std::runtime_error("Cannot enqueue on stopped ThreadPool");
+        }
+
+        push(Task([task]() { (*task)(); }), priority);
+        return res;
+    }
+
+    // Fire-and-forget submission. No future, no shared state: closures that
+    // fit in TaskFunction::InlineSize are queued without any heap allocation.
+    // Exceptions thrown by the task are logged and dropped.
+    template<class F>
+    void post(F&& f) {
+        post(TaskPriority::Normal, std::forward<F>(f));
+    }
+
+    template<class F>
+    void post(TaskPriority priority, F&& f) {
+        if (stop.load()) {
+            throw std::runtime_error("Cannot post on stopped ThreadPool");
+        }
+        push(Task(std::forward<F>(f)), priority);
+    }
+
+    // Like post(), but runs the task immediately when already on one of this
+    // pool's workers instead of paying for a queue round-trip.
+    template<class F>
+    void dispatch(F&& f) {
+        if (currentPool == this) {
+            std::forward<F>(f)();
+            return;
+        }
+        post(std::forward<F>(f));
+    }
+
+    // Calls body(i) for every i in [begin, end), split into chunks of `grain`
+    // indices that run on the workers. grain == 0 picks a chunk size that gives
+    // each worker a few chunks to balance load. The calling thread works on
+    // chunks too and only returns once the whole range is done; the first
+    // exception thrown by body is rethrown here.
+    template<class Index, class F>
+    void parallelFor(Index begin, Index end, size_t grain, F&& body) {
+        if (end <= begin) {
+            return;
+        }
+
+        const size_t count = static_cast<size_t>(end - begin);
+        grain = resolveGrain(count, grain);
+        const size_t chunkCount = (count + grain - 1) / grain;
+
+        runChunks(chunkCount, [&](size_t chunk) {
+            const Index chunkBegin = begin + static_cast<Index>(chunk * grain);
+            const Index chunkEnd = begin + static_cast<Index>(std::min(count, (chunk + 1) * grain));
+            for (Index i = chunkBegin; i < chunkEnd; ++i) {
+                body(i);
             }
+        });
+    }
 
-            tasks.emplace([task]() { (*task)(); });
+    // Maps every index in [begin, end) through transform(i) and folds the
+    // results with combine. Each chunk is reduced independently and the
+    // partial results are combined in chunk order on the calling thread, so
+    // for a given grain the result does not depend on scheduling.
+    template<class Index, class T, class Transform, class Combine>
+    T parallelReduce(Index begin, Index end, size_t grain, T identity,
+                     Transform&& transform, Combine&& combine) {
+        if (end <= begin) {
+            return identity;
         }
-        condition.notify_one();
-        return res;
+
+        const size_t count = static_cast<size_t>(end - begin);
+        grain = resolveGrain(count, grain);
+        const size_t chunkCount = (count + grain - 1) / grain;
+
+        std::vector<T> partials(chunkCount, identity);
+        runChunks(chunkCount, [&](size_t chunk) {
+            const Index chunkBegin = begin + static_cast<Index>(chunk * grain);
+            const Index chunkEnd = begin + static_cast<Index>(std::min(count, (chunk + 1) * grain));
+            T acc = identity;
+            for (Index i = chunkBegin; i < chunkEnd; ++i) {
+                acc = combine(std::move(acc), transform(i));
+            }
+            partials[chunk] = std::move(acc);
+        });
+
+        T result = std::move(identity);
+        for (auto& partial : partials) {
+            result = combine(std::move(result), std::move(partial));
+        }
+        return result;
+    }
+
+    // Runs one queued task on the calling thread, if there is one. Used by
+    // threads that would otherwise block waiting for pool work to finish.
+    // Background tasks are left alone by default so a frame waiting on its
+    // own work never ends up running an autosave.
+    bool tryRunPendingTask(TaskPriority lowest = TaskPriority::Normal) {
+        Task task;
+        size_t lane = 0;
+        const bool onWorker = currentPool == this;
+        if (!tryPopTask(onWorker ? currentIndex : 0, task, lane, onWorker, laneOf(lowest))) {
+            return false;
+        }
+        runTask(task, lane);
+        return true;
+    }
+
+    // True when the calling task is running on this pool and work of a
+    // higher priority than its own is waiting.
+    bool shouldYield() const {
+        if (currentPool != this) {
+            return false;
+        }
+        for (size_t lane = 0; lane < currentLane; ++lane) {
+            if (pendingByLane[lane].load(std::memory_order_relaxed) > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Safe point for long-running tasks: runs every queued task of a higher
+    // priority than the calling task on this thread, then returns to it.
+    // Returns whether anything ran. Only call it where the task holds no
+    // locks that the higher-priority work might need.
+    bool yieldToHigherPriority() {
+        if (!shouldYield()) {
+            return false;
+        }
+
+        const size_t ownLane = currentLane;
+        bool ranAny = false;
+        Task task;
+        size_t lane = 0;
+        while (tryPopTask(currentIndex, task, lane, true, ownLane - 1)) {
+            runTask(task, lane);
+            ranAny = true;
+        }
+        return ranAny;
+    }
+
+    size_t workerCount() const {
+        return workers.size();
     }
 
     ~ThreadPool() {
         {
-            std::unique_lock<std::mutex> lock(queueMutex);
+            std::unique_lock<std::mutex> lock(sleepMutex);
             stop = true;
         }
         condition.notify_all();
@@ -74,11 +230,191 @@ public:
     }
 
 private:
+    using Task = TaskFunction;
+
     std::vector<std::thread> workers;
-    std::queue<std::function<void()>> tasks;
-    std::mutex queueMutex;
+    // queues[lane][worker]
+    std::array<std::vector<std::unique_ptr<WorkStealingQueue<Task>>>, LaneCount> queues;
+
+    // Tasks sitting in any deque; lets idle workers sleep without polling
+    std::atomic<size_t> pendingTasks{0};
+    std::array<std::atomic<size_t>, LaneCount> pendingByLane{};
+    std::atomic<size_t> sleepingWorkers{0};
+    std::atomic<size_t> nextQueue{0};
+    std::atomic<bool> stop{false};
+
+    std::mutex sleepMutex;
     std::condition_variable condition;
-    bool stop = false;
+
+    // Identifies the pool and deque owned by the calling worker thread
+    inline static thread_local ThreadPool* currentPool = nullptr;
+    inline static thread_local size_t currentIndex = 0;
+    // Lane of the task the calling thread is running; lowest when idle
+    inline static thread_local size_t currentLane = LaneCount - 1;
+
+    static constexpr size_t laneOf(TaskPriority priority) {
+        return static_cast<size_t>(priority);
+    }
+
+    void push(Task task, TaskPriority priority) {
+        const size_t lane = laneOf(priority);
+        auto& laneQueues = queues[lane];
+
+        // Count the task before it becomes visible so the counters never underflow
+        pendingTasks.fetch_add(1);
+        pendingByLane[lane].fetch_add(1, std::memory_order_relaxed);
+
+        if (currentPool == this) {
+            laneQueues[currentIndex]->push(std::move(task));
+        } else {
+            laneQueues[nextQueue.fetch_add(1, std::memory_order_relaxed) % laneQueues.size()]->push(std::move(task));
+        }
+
+        if (sleepingWorkers.load() > 0) {
+            // Taking the lock orders us against a worker that is about to wait
+            { std::lock_guard<std::mutex> lock(sleepMutex); }
+            condition.notify_one();
+        }
+    }
+
+    // Takes the highest-priority task available in lanes [0, lowestLane],
+    // preferring our own deque within each lane
+    bool tryPopTask(size_t index, Task& task, size_t& lane, bool ownsQueue = true,
+                    size_t lowestLane = LaneCount - 1) {
+        for (lane = 0; lane <= lowestLane; ++lane) {
+            if (pendingByLane[lane].load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+
+            auto& laneQueues = queues[lane];
+            if (ownsQueue && laneQueues[index]->tryPop(task)) {
+                taken(lane);
+                return true;
+            }
+
+            // Steal from the other workers, starting with our neighbour
+            for (size_t offset = ownsQueue ? 1 : 0; offset < laneQueues.size(); ++offset) {
+                if (laneQueues[(index + offset) % laneQueues.size()]->trySteal(task)) {
+                    taken(lane);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void taken(size_t lane) {
+        pendingByLane[lane].fetch_sub(1, std::memory_order_relaxed);
+        pendingTasks.fetch_sub(1);
+    }
+
+    // A posted task has nobody to report to, and the thread running it may
+    // be a caller helping out while it waits on unrelated work, so an
+    // exception is logged here instead of unwinding into that thread
+    void runTask(Task& task, size_t lane) {
+        const size_t previousLane = currentLane;
+        currentLane = lane;
+        {
+            PROFILE_SCOPE("ThreadPool_TaskExecution");
+            try {
+                task();
+            } catch (const std::exception& e) {
+                spdlog::error("ThreadPool task threw: {}", e.what());
+            } catch (...) {
+                spdlog::error("ThreadPool task threw a non-standard exception");
+            }
+        }
+        currentLane = previousLane;
+    }
+
+    size_t resolveGrain(size_t count, size_t grain) const {
+        if (grain > 0) {
+            return grain;
+        }
+        // Roughly four chunks per thread (workers plus the caller)
+        const size_t targetChunks = (workers.size() + 1) * 4;
+        return std::max<size_t>(1, (count + targetChunks - 1) / targetChunks);
+    }
+
+    // Executes runChunk(0 .. chunkCount-1) across the pool. Helpers and the
+    // caller claim chunks from a shared counter; the caller keeps running pool
+    // tasks until every helper has let go of the stack-allocated state.
+    template<class F>
+    void runChunks(size_t chunkCount, F&& runChunk) {
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> helpersRemaining{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+
+        auto work = [&]() {
+            for (size_t chunk = nextChunk.fetch_add(1); chunk < chunkCount;
+                 chunk = nextChunk.fetch_add(1)) {
+                if (failed.load(std::memory_order_relaxed)) {
+                    continue;
+                }
+                try {
+                    runChunk(chunk);
+                } catch (...) {
+                    if (!failed.exchange(true)) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        };
+
+        const size_t helpers = std::min(chunkCount - 1, workers.size());
+        helpersRemaining.store(helpers);
+        // Charge the helpers' allocations to the caller's zone
+        const uint32_t zone = Profiler::currentZone();
+        for (size_t i = 0; i < helpers; ++i) {
+            post(TaskPriority::FrameCritical, [&work, &helpersRemaining, zone]() {
+                {
+                    MemoryTag tag(zone);
+                    work();
+                }
+                helpersRemaining.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        work();
+
+        while (helpersRemaining.load(std::memory_order_acquire) > 0) {
+            if (!tryRunPendingTask()) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void workerLoop(size_t index) {
+        currentPool = this;
+        currentIndex = index;
+        Profiler::getInstance().setThreadName("ThreadPool Worker " + std::to_string(index));
+        SamplingProfiler::registerThread();
+
+        while (true) {
+            Task task;
+            size_t lane = 0;
+            if (tryPopTask(index, task, lane)) {
+                runTask(task, lane);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            sleepingWorkers.fetch_add(1);
+            condition.wait(lock, [this] {
+                return stop.load() || pendingTasks.load() > 0;
+            });
+            sleepingWorkers.fetch_sub(1);
+
+            if (stop.load() && pendingTasks.load() == 0) {
+                return;
+            }
+        }
+    }
 };
 
 } // namespace Core
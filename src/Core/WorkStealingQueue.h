@@ -0,0 +1,82 @@
+#pragma once
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ForgeEngine {
+namespace Core {
+
+// Per-worker task deque. The owning worker pushes and pops at the back (LIFO,
+// keeps freshly spawned work hot in cache), other workers steal from the front
+// (FIFO, takes the oldest and usually largest piece of work).
+//
+// Backed by a ring buffer that only ever grows, so once it has reached its
+// working size pushing and popping never allocates.
+template<typename T>
+class WorkStealingQueue {
+public:
+    explicit WorkStealingQueue(size_t initialCapacity = 256)
+        : buffer(roundUpToPowerOfTwo(initialCapacity)) {}
+
+    WorkStealingQueue(const WorkStealingQueue&) = delete;
+    WorkStealingQueue& operator=(const WorkStealingQueue&) = delete;
+
+    void push(T item) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (tail - head == buffer.size()) {
+            grow();
+        }
+        buffer[tail & (buffer.size() - 1)] = std::move(item);
+        ++tail;
+    }
+
+    bool tryPop(T& out) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (head == tail) {
+            return false;
+        }
+        --tail;
+        out = std::move(buffer[tail & (buffer.size() - 1)]);
+        return true;
+    }
+
+    bool trySteal(T& out) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        if (head == tail) {
+            return false;
+        }
+        out = std::move(buffer[head & (buffer.size() - 1)]);
+        ++head;
+        return true;
+    }
+
+    bool empty() const {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        return head == tail;
+    }
+
+private:
+    std::vector<T> buffer;
+    size_t head = 0;
+    size_t tail = 0;
+    mutable std::mutex queueMutex;
+
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t capacity = 1;
+        while (capacity < value) {
+            capacity <<= 1;
+        }
+        return capacity;
+    }
+
+    void grow() {
+        std::vector<T> larger(buffer.size() * 2);
+        for (size_t i = head; i != tail; ++i) {
+            larger[i & (larger.size() - 1)] = std::move(buffer[i & (buffer.size() - 1)]);
+        }
+        buffer = std::move(larger);
+    }
+};
+
+} // namespace Core
+} // namespace ForgeEngine
@@ -30,15 +30,12 @@ private:
         // Create diverse NPCs with different traits and personalities
         auto blacksmith = std::make_unique<Forge::AdvancedNPC>("Erik", 
             Forge::NPCTraits{8, 5, 9, 6});
-        blacksmith->SetCurrentState(Forge::NPCState::Working);
 
         auto baker = std::make_unique<Forge::AdvancedNPC>("Ingrid", 
             Forge::NPCTraits{7, 8, 6, 7});
-        baker->SetCurrentState(Forge::NPCState::Working);
 
         auto farmer = std::make_unique<Forge::AdvancedNPC>("Olaf", 
             Forge::NPCTraits{6, 4, 8, 5});
-        farmer->SetCurrentState(Forge::NPCState::Working);
 
         m_npcManager.AddNPC(std::move(blacksmith));
         m_npcManager.AddNPC(std::move(baker));
@@ -49,47 +46,32 @@ private:
         std::cout << "\n--- Time: " << std::fixed << std::setprecision(1) 
                   << currentTime << " hours ---" << std::endl;
 
-        for (auto* npc : m_npcManager.GetAllNPCs()) {
-            SimulateNPC(npc, currentTime);
-        }
+        // NPCs pick a state for the hour and act on it
+        m_npcManager.SetTimeOfDay(currentTime);
+        m_npcManager.Update(0.5f * 3600.0f);
+
+        m_npcManager.GetWorld().query<const Forge::NPCComponent, const Forge::NPCState, const Forge::NPCMemory>().forEach(
+            [this](const Forge::NPCComponent& component, const Forge::NPCState& state,
+                   const Forge::NPCMemory& memory) {
+                PrintNPC(*component.npc, state, memory);
+            });
     }
 
-    void SimulateNPC(Forge::AdvancedNPC* npc, float currentTime) {
-        // Simulate NPC behavior based on time and needs
-        std::cout << "NPC: " << npc->GetName() << std::endl;
+    void PrintNPC(const Forge::AdvancedNPC& npc, Forge::NPCState state, const Forge::NPCMemory& memory) {
+        std::cout << "NPC: " << npc.GetName() << std::endl;
         
         // Print current state and needs
-        std::cout << "  State: " << GetStateName(npc->GetCurrentState()) 
+        std::cout << "  State: " << GetStateName(state) 
                   << std::endl;
         std::cout << "  Hunger: " << std::fixed << std::setprecision(2) 
-                  << npc->GetHunger() << std::endl;
-        std::cout << "  Energy: " << npc->GetEnergy() << std::endl;
-        std::cout << "  Social Need: " << npc->GetSocialNeed() << std::endl;
-
-        // Perform NPC-specific actions
-        switch (npc->GetCurrentState()) {
-            case Forge::NPCState::Working:
-                npc->PerformWork();
-                break;
-            case Forge::NPCState::Eating:
-                npc->Eat();
-                break;
-            case Forge::NPCState::Resting:
-                npc->Rest();
-                break;
-            case Forge::NPCState::Socializing:
-                npc->Interact();
-                break;
-            default:
-                npc->Wander();
-                break;
-        }
+                  << npc.GetHunger() << std::endl;
+        std::cout << "  Energy: " << npc.GetEnergy() << std::endl;
+        std::cout << "  Social Need: " << npc.GetSocialNeed() << std::endl;
 
         // Print recent memories
-        auto memories = npc->GetRecentMemories(2);
         std::cout << "  Recent Memories:" << std::endl;
-        for (const auto& memory : memories) {
-            std::cout << "    - " << memory << std::endl;
+        for (const auto& event : memory.GetRecent(2)) {
+            std::cout << "    - " << event.view() << std::endl;
         }
     }
 
@@ -1,8 +1,11 @@
 #pragma once
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <queue>
+#include <span>
 #include "../Core/ThreadPool.h"
+#include "../Core/TaskGroup.h"
 #include "EconomicSystem.h"
 #include "EnvironmentalSystem.h"
 #include "../AI/PersonalitySystem.h"
@@ -37,24 +40,27 @@ public:
 
     void updateMarket(float deltaTime) {
         PROFILE_SCOPE("AdvancedTradeSystem_Update");
+        ForgeEngine::Core::TaskGroup frameTasks(*m_threadPool);
 
-        // Update market demands
-        updateDemands(deltaTime);
+        // Update market demands; everything below depends on them
+        updateDemands(frameTasks, deltaTime);
+        frameTasks.wait();
+
+        // Generate new trade opportunities; only reads demands, so it can
+        // overlap contract processing
+        generateTradeOpportunities(frameTasks);
 
         // Process trade contracts
         processContracts(deltaTime);
-
-        // Generate new trade opportunities
-        generateTradeOpportunities();
+        frameTasks.wait();
 
         // Update prices based on supply and demand
         updatePrices();
     }
 
     float getCurrentPrice(ResourceType resource) const {
-        auto it = marketDemands.find(resource);
-        if (it != marketDemands.end()) {
-            const auto& demand = it->second;
+        const auto& demand = marketDemands[resource];
+        if (isTraded(demand)) {
             float envModifier = m_environmentalSystem->getResourceProductionModifier(resource);
             return demand.basePrice * demand.currentDemand * (1.0f / envModifier);
         }
@@ -89,18 +95,33 @@ public:
         return activeContracts;
     }
 
+    // Valid until the contract list next changes
+    std::span<const TradeContract> getActiveContractsView() const {
+        return activeContracts;
+    }
+
     std::vector<MarketDemand> getMarketDemands() const {
         std::vector<MarketDemand> demands;
-        for (const auto& [type, demand] : marketDemands) {
+        forEachTraded([&demands](ResourceType, const MarketDemand& demand) {
             demands.push_back(demand);
-        }
+        });
+        return demands;
+    }
+
+    std::pmr::vector<MarketDemand> getMarketDemands(std::pmr::memory_resource* resource) const {
+        std::pmr::vector<MarketDemand> demands(resource);
+        demands.reserve(ResourceTypeCount);
+        forEachTraded([&demands](ResourceType, const MarketDemand& demand) {
+            demands.push_back(demand);
+        });
         return demands;
     }
 
 private:
     std::shared_ptr<ForgeEngine::Core::ThreadPool> m_threadPool;
     std::shared_ptr<EnvironmentalSystem> m_environmentalSystem;
-    std::unordered_map<ResourceType, MarketDemand> marketDemands;
+    // Resources nobody trades keep a zero base price
+    ResourceArray<MarketDemand> marketDemands;
     std::vector<TradeContract> activeContracts;
     std::queue<TradeContract> pendingContracts;
 
@@ -123,11 +144,31 @@ private:
         // Add more resources
     }
 
-    void updateDemands(float deltaTime) {
-        m_threadPool->enqueue([this, deltaTime]() {
-            PROFILE_SCOPE("AdvancedTradeSystem_UpdateDemands");
+    static bool isTraded(const MarketDemand& demand) {
+        return demand.basePrice > 0.0f;
+    }
+
+    // Calls fn(type, demand) for every resource with a market
+    template<typename F>
+    void forEachTraded(F&& fn) {
+        marketDemands.forEach([&fn](ResourceType type, MarketDemand& demand) {
+            if (isTraded(demand)) fn(type, demand);
+        });
+    }
+
+    template<typename F>
+    void forEachTraded(F&& fn) const {
+        marketDemands.forEach([&fn](ResourceType type, const MarketDemand& demand) {
+            if (isTraded(demand)) fn(type, demand);
+        });
+    }
+
+    void updateDemands(ForgeEngine::Core::TaskGroup& tasks, float deltaTime) {
+        // Each resource's demand is independent, so update them side by side
+        forEachTraded([this, &tasks](ResourceType type, MarketDemand& demand) {
+            tasks.run([this, type, &demand]() {
+                PROFILE_SCOPE("AdvancedTradeSystem_UpdateDemands");
 
-            for (auto& [type, demand] : marketDemands) {
                 // Environmental factors affect demand
                 float envModifier = m_environmentalSystem->getResourceProductionModifier(type);
                 
@@ -140,7 +181,7 @@ private:
                     demand.currentDemand * envModifier * seasonalDemand,
                     0.5f, 2.0f
                 );
-            }
+            });
         });
     }
 
@@ -176,12 +217,12 @@ private:
         }
     }
 
-    void generateTradeOpportunities() {
-        m_threadPool->enqueue([this]() {
+    void generateTradeOpportunities(ForgeEngine::Core::TaskGroup& tasks) {
+        tasks.run([this]() {
             PROFILE_SCOPE("AdvancedTradeSystem_GenerateOpportunities");
 
             // Generate trade opportunities based on current market conditions
-            for (const auto& [type, demand] : marketDemands) {
+            forEachTraded([this](ResourceType type, const MarketDemand& demand) {
                 if (demand.currentDemand > 1.5f) {
                     // High demand - generate more selling opportunities
                     generateSellingOpportunity(type);
@@ -190,7 +231,7 @@ private:
                     // Low demand - generate buying opportunities
                     generateBuyingOpportunity(type);
                 }
-            }
+            });
         });
     }
 
@@ -205,7 +246,7 @@ private:
     }
 
     void updatePrices() {
-        for (auto& [type, demand] : marketDemands) {
+        forEachTraded([this](ResourceType type, MarketDemand& demand) {
             float envModifier = m_environmentalSystem->getResourceProductionModifier(type);
             float supplySurplus = calculateSupplySurplus(type);
             
@@ -218,7 +259,7 @@ private:
             
             // Ensure price doesn't go too low or high
             demand.basePrice = std::clamp(demand.basePrice, 1.0f, 100.0f);
-        }
+        });
     }
 
     float calculateSupplySurplus(ResourceType type) {
@@ -232,9 +273,9 @@ private:
             }
         }
         
-        auto it = marketDemands.find(type);
-        if (it != marketDemands.end()) {
-            totalDemand = it->second.currentDemand * 100.0f; // Base demand value
+        const auto& demand = marketDemands[type];
+        if (isTraded(demand)) {
+            totalDemand = demand.currentDemand * 100.0f; // Base demand value
         }
         
         return (totalSupply - totalDemand) / totalDemand;
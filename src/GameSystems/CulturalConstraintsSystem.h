@@ -1,5 +1,6 @@
 #pragma once
 #include "../GameSystems/NPCAdvanced.h"
+#include "../Core/Symbol.h"
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -40,7 +41,7 @@ public:
     void ApplyConstraints(PopulationNPC* npc);
 
     // Generate culturally appropriate life events
-    std::vector<std::string> GenerateCulturalEvents(PopulationNPC* npc);
+    std::vector<ForgeEngine::Core::Symbol> GenerateCulturalEvents(PopulationNPC* npc);
 
 private:
     CulturalContext m_currentContext;
@@ -56,9 +57,9 @@ private:
     bool ValidateReligiousPractice(PopulationNPC* npc);
 
     // Event generation based on cultural context
-    std::string GenerateMarriageEvent(PopulationNPC* npc);
-    std::string GenerateOccupationEvent(PopulationNPC* npc);
-    std::string GenerateMobilityEvent(PopulationNPC* npc);
+    ForgeEngine::Core::Symbol GenerateMarriageEvent(PopulationNPC* npc);
+    ForgeEngine::Core::Symbol GenerateOccupationEvent(PopulationNPC* npc);
+    ForgeEngine::Core::Symbol GenerateMobilityEvent(PopulationNPC* npc);
 };
 
 } // namespace Forge
@@ -4,28 +4,36 @@
 
 namespace Forge {
 
+namespace {
+
+// Simplified valuation of one unit of each resource
+constexpr ResourceArray<float> WealthPerUnit{
+    {ResourceType::Food, 1.0f},
+    {ResourceType::Wood, 0.5f},
+    {ResourceType::Stone, 0.7f},
+    {ResourceType::Metal, 1.2f},
+    {ResourceType::Cloth, 0.8f},
+    {ResourceType::Tools, 1.5f}
+};
+
+} // namespace
+
 EconomicAgent::EconomicAgent(const std::string& name) : 
     m_name(name), 
     m_profession(Profession::Farmer),
     m_skillProficiency(0.1f) {}
 
 void EconomicAgent::AddResource(ResourceType type, float quantity) {
-    auto& resource = m_resources[type];
-    resource.type = type;
-    resource.quantity += quantity;
-    resource.quality = std::min(1.0f, resource.quality + 0.01f);
+    m_quantities[type] += quantity;
+    m_qualities[type] = std::min(1.0f, m_qualities[type] + 0.01f);
 }
 
 float EconomicAgent::GetResourceQuantity(ResourceType type) const {
-    auto it = m_resources.find(type);
-    return (it != m_resources.end()) ? it->second.quantity : 0.0f;
+    return m_quantities[type];
 }
 
 void EconomicAgent::ConsumeResource(ResourceType type, float amount) {
-    auto it = m_resources.find(type);
-    if (it != m_resources.end()) {
-        it->second.quantity = std::max(0.0f, it->second.quantity - amount);
-    }
+    m_quantities[type] = std::max(0.0f, m_quantities[type] - amount);
 }
 
 void EconomicAgent::SetProfession(Profession prof) {
@@ -93,8 +101,10 @@ float EconomicAgent::CalculateConsumptionNeeds() const {
     }
 }
 
-VillageEconomy::VillageEconomy(int initialPopulation) : 
-    m_randomGenerator(std::random_device{}()) {
+VillageEconomy::VillageEconomy(int initialPopulation,
+                               std::shared_ptr<ForgeEngine::Core::ThreadPool> threadPool) : 
+    m_randomGenerator(std::random_device{}()),
+    m_threadPool(std::move(threadPool)) {
     
     std::uniform_int_distribution<> profDist(0, 6);
     
@@ -118,42 +128,42 @@ void VillageEconomy::SimulateEconomicCycle(float deltaTime) {
 }
 
 void VillageEconomy::ProduceResources() {
-    for (auto& agent : m_economicAgents) {
-        float production = agent->CalculateProductionOutput();
+    ForEachAgent([](EconomicAgent& agent) {
+        float production = agent.CalculateProductionOutput();
         
         // Produce resources based on profession
-        switch (agent->GetProfession()) {
+        switch (agent.GetProfession()) {
             case Profession::Farmer:
-                agent->AddResource(ResourceType::Food, production);
+                agent.AddResource(ResourceType::Food, production);
                 break;
             case Profession::Blacksmith:
-                agent->AddResource(ResourceType::Metal, production * 0.5f);
-                agent->AddResource(ResourceType::Tools, production * 0.3f);
+                agent.AddResource(ResourceType::Metal, production * 0.5f);
+                agent.AddResource(ResourceType::Tools, production * 0.3f);
                 break;
             case Profession::Carpenter:
-                agent->AddResource(ResourceType::Wood, production);
+                agent.AddResource(ResourceType::Wood, production);
                 break;
             case Profession::Weaver:
-                agent->AddResource(ResourceType::Cloth, production);
+                agent.AddResource(ResourceType::Cloth, production);
                 break;
             case Profession::Miner:
-                agent->AddResource(ResourceType::Stone, production * 0.6f);
-                agent->AddResource(ResourceType::Metal, production * 0.4f);
+                agent.AddResource(ResourceType::Stone, production * 0.6f);
+                agent.AddResource(ResourceType::Metal, production * 0.4f);
                 break;
             default:
                 break;
         }
-    }
+    });
 }
 
 void VillageEconomy::ConsumeResources() {
-    for (auto& agent : m_economicAgents) {
-        float consumption = agent->CalculateConsumptionNeeds();
+    ForEachAgent([](EconomicAgent& agent) {
+        float consumption = agent.CalculateConsumptionNeeds();
         
         // Consume essential resources
-        agent->ConsumeResource(ResourceType::Food, consumption);
-        agent->ConsumeResource(ResourceType::Wood, consumption * 0.2f);
-    }
+        agent.ConsumeResource(ResourceType::Food, consumption);
+        agent.ConsumeResource(ResourceType::Wood, consumption * 0.2f);
+    });
 }
 
 void VillageEconomy::DistributeResources() {
@@ -182,18 +192,12 @@ void VillageEconomy::HandleTradeAndExchange() {
 }
 
 float VillageEconomy::GetTotalResourceValue() const {
-    float totalValue = 0.0f;
+    // Sum the holdings first; pricing them is then a single dot product
+    ResourceArray<float> holdings;
     for (const auto& agent : m_economicAgents) {
-        // Simplified resource valuation
-        totalValue += 
-            agent->GetResourceQuantity(ResourceType::Food) * 1.0f +
-            agent->GetResourceQuantity(ResourceType::Wood) * 0.5f +
-            agent->GetResourceQuantity(ResourceType::Stone) * 0.7f +
-            agent->GetResourceQuantity(ResourceType::Metal) * 1.2f +
-            agent->GetResourceQuantity(ResourceType::Cloth) * 0.8f +
-            agent->GetResourceQuantity(ResourceType::Tools) * 1.5f;
+        holdings += agent->GetResourceQuantities();
     }
-    return totalValue;
+    return dot(holdings, WealthPerUnit);
 }
 
 float VillageEconomy::GetAverageWealthPerCapita() const {
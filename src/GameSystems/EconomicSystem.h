@@ -4,19 +4,11 @@
 #include <vector>
 #include <memory>
 #include <random>
+#include "../Core/ThreadPool.h"
+#include "ResourceArray.h"
 
 namespace Forge {
 
-// Economic Resource Types
-enum class ResourceType {
-    Food,
-    Wood,
-    Stone,
-    Metal,
-    Cloth,
-    Tools
-};
-
 // Profession Specializations
 enum class Profession {
     Farmer,
@@ -43,6 +35,7 @@ public:
     void AddResource(ResourceType type, float quantity);
     float GetResourceQuantity(ResourceType type) const;
     void ConsumeResource(ResourceType type, float amount);
+    const ResourceArray<float>& GetResourceQuantities() const { return m_quantities; }
 
     // Profession and Skill
     void SetProfession(Profession prof);
@@ -56,14 +49,16 @@ public:
 
 private:
     std::string m_name;
-    std::unordered_map<ResourceType, Resource> m_resources;
+    ResourceArray<float> m_quantities;
+    ResourceArray<float> m_qualities;
     Profession m_profession;
     float m_skillProficiency;
 };
 
 class VillageEconomy {
 public:
-    VillageEconomy(int initialPopulation);
+    VillageEconomy(int initialPopulation,
+                   std::shared_ptr<ForgeEngine::Core::ThreadPool> threadPool = nullptr);
 
     // Economic Cycle Management
     void SimulateEconomicCycle(float deltaTime);
@@ -78,8 +73,23 @@ public:
 
 private:
     std::vector<std::unique_ptr<EconomicAgent>> m_economicAgents;
-    std::unordered_map<ResourceType, float> m_communalResources;
+    ResourceArray<float> m_communalResources;
     std::mt19937 m_randomGenerator;
+    std::shared_ptr<ForgeEngine::Core::ThreadPool> m_threadPool;
+
+    // Applies fn to every agent, in parallel when a thread pool is available.
+    // fn must only touch the agent it is given.
+    template<typename F>
+    void ForEachAgent(F&& fn) {
+        if (m_threadPool) {
+            m_threadPool->parallelFor(size_t{0}, m_economicAgents.size(), 0,
+                [this, &fn](size_t i) { fn(*m_economicAgents[i]); });
+        } else {
+            for (auto& agent : m_economicAgents) {
+                fn(*agent);
+            }
+        }
+    }
 
     // Internal Economic Calculations
     void ProduceResources();
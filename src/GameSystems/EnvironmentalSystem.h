@@ -2,7 +2,9 @@
 #include <vector>
 #include <memory>
 #include <random>
+#include <span>
 #include "../Core/ThreadPool.h"
+#include "../Core/TaskGroup.h"
 #include "../Core/Profiler.h"
 #include "EconomicSystem.h"
 
@@ -47,6 +49,7 @@ public:
 
     void updateEnvironment(float deltaTime) {
         PROFILE_SCOPE("EnvironmentalSystem_Update");
+        ForgeEngine::Core::TaskGroup frameTasks(*m_threadPool);
 
         // Update climate
         updateClimate(deltaTime);
@@ -58,7 +61,10 @@ public:
         generateRandomEvents(deltaTime);
 
         // Update resource impacts
-        updateResourceImpacts();
+        updateResourceImpacts(frameTasks);
+
+        // Impacts read the climate and events the next update writes
+        frameTasks.wait();
     }
 
     float getResourceProductionModifier(ResourceType type) const {
@@ -83,6 +89,11 @@ public:
         return activeEvents;
     }
 
+    // Valid until the event list next changes
+    std::span<const EnvironmentalEvent> getActiveEventsView() const {
+        return activeEvents;
+    }
+
     const Climate& getCurrentClimate() const {
         return currentClimate;
     }
@@ -249,9 +260,9 @@ private:
         return modifier;
     }
 
-    void updateResourceImpacts() {
+    void updateResourceImpacts(ForgeEngine::Core::TaskGroup& tasks) {
         // Update resource production modifiers based on current environmental conditions
-        m_threadPool->enqueue([this]() {
+        tasks.run([this]() {
             PROFILE_SCOPE("EnvironmentalSystem_ResourceImpacts");
             // Implement resource impact calculations
         });
@@ -3,6 +3,8 @@
 #include <memory>
 #include <unordered_map>
 #include "../Core/ThreadPool.h"
+#include "../Core/Symbol.h"
+#include "../Core/SystemScheduler.h"
 #include "EnvironmentalSystem.h"
 #include "TechnologySystem.h"
 #include "AdvancedTradeSystem.h"
@@ -15,8 +17,8 @@ struct Village {
     std::string name;
     sf::Vector2f position;
     size_t population;
-    std::unordered_map<ResourceType, float> resources;
-    std::vector<std::string> technologies;
+    ResourceArray<float> resources;
+    std::vector<ForgeEngine::Core::Symbol> technologies;
     float prosperity;
     float influence;
     
@@ -65,29 +67,16 @@ public:
         m_environmentalSystem(envSystem),
         m_technologySystem(techSystem),
         m_tradeSystem(tradeSystem),
-        m_storySystem(storySystem) {
+        m_storySystem(storySystem),
+        m_phaseScheduler(threadPool) {
         initializeVillages();
+        registerUpdatePhases();
     }
 
     void update(float deltaTime) {
         PROFILE_SCOPE("MultiVillageSystem_Update");
 
-        // Update each village
-        for (auto& village : m_villages) {
-            updateVillage(village, deltaTime);
-        }
-
-        // Update trade routes
-        updateTradeRoutes(deltaTime);
-
-        // Update diplomatic relations
-        updateDiplomacy(deltaTime);
-
-        // Update technology diffusion
-        updateTechnologyDiffusion(deltaTime);
-
-        // Generate inter-village events
-        generateEvents();
+        m_phaseScheduler.run(deltaTime);
     }
 
     void addVillage(const std::string& name, const sf::Vector2f& position) {
@@ -152,6 +141,50 @@ private:
     std::vector<TradeRoute> m_tradeRoutes;
     std::vector<DiplomaticAgreement> m_diplomaticAgreements;
 
+    ForgeEngine::Core::SystemScheduler m_phaseScheduler;
+
+    void registerUpdatePhases() {
+        // Update each village; a village's own update only touches that village
+        m_phaseScheduler.addSystem({
+            "Villages", {}, {"Villages"},
+            [this](float dt) {
+                if (m_threadPool) {
+                    m_threadPool->parallelFor(size_t{0}, m_villages.size(), 0, [this, dt](size_t i) {
+                        updateVillage(m_villages[i], dt);
+                    });
+                } else {
+                    for (auto& village : m_villages) {
+                        updateVillage(village, dt);
+                    }
+                }
+            }
+        });
+
+        // Update trade routes
+        m_phaseScheduler.addSystem({
+            "TradeRoutes", {}, {"Villages", "TradeRoutes"},
+            [this](float dt) { updateTradeRoutes(dt); }
+        });
+
+        // Update diplomatic relations; independent of the village phases
+        m_phaseScheduler.addSystem({
+            "Diplomacy", {}, {"DiplomaticAgreements", "Stories"},
+            [this](float dt) { updateDiplomacy(dt); }
+        });
+
+        // Update technology diffusion
+        m_phaseScheduler.addSystem({
+            "TechnologyDiffusion", {}, {"Villages", "Stories"},
+            [this](float dt) { updateTechnologyDiffusion(dt); }
+        });
+
+        // Generate inter-village events
+        m_phaseScheduler.addSystem({
+            "Events", {"Villages", "TradeRoutes", "DiplomaticAgreements"}, {"Stories"},
+            [this](float) { generateEvents(); }
+        });
+    }
+
     void initializeVillages() {
         // Create initial villages
         addVillage("Rivertown", sf::Vector2f(0, 0));
@@ -161,11 +194,13 @@ private:
 
     void initializeVillageResources(Village& village) {
         // Set initial resource quantities
-        village.resources[ResourceType::Food] = 1000.0f;
-        village.resources[ResourceType::Wood] = 500.0f;
-        village.resources[ResourceType::Stone] = 300.0f;
-        village.resources[ResourceType::Metal] = 100.0f;
-        village.resources[ResourceType::Tools] = 50.0f;
+        village.resources = {
+            {ResourceType::Food, 1000.0f},
+            {ResourceType::Wood, 500.0f},
+            {ResourceType::Stone, 300.0f},
+            {ResourceType::Metal, 100.0f},
+            {ResourceType::Tools, 50.0f}
+        };
     }
 
     void updateVillage(Village& village, float deltaTime) {
@@ -188,13 +223,15 @@ private:
     }
 
     void updateResources(Village& village, float deltaTime) {
-        for (auto& [type, quantity] : village.resources) {
-            float production = calculateResourceProduction(village, type);
-            float consumption = calculateResourceConsumption(village, type);
-            
-            quantity += (production - consumption) * deltaTime;
-            quantity = std::max(0.0f, quantity);
-        }
+        ResourceArray<float> netChange;
+        netChange.forEach([&](ResourceType type, float& change) {
+            change = calculateResourceProduction(village, type) -
+                     calculateResourceConsumption(village, type);
+        });
+
+        // Applied to every resource at once
+        village.resources += netChange * deltaTime;
+        village.resources.clampNonNegative();
     }
 
     void updateProsperity(Village& village) {
@@ -239,7 +276,7 @@ private:
 
     void updateTechnologyDiffusion(float deltaTime) {
         for (auto& village : m_villages) {
-            for (const auto& tech : village.technologies) {
+            for (ForgeEngine::Core::Symbol tech : village.technologies) {
                 spreadTechnology(village, tech, deltaTime);
             }
         }
@@ -301,10 +338,7 @@ private:
     }
 
     float calculateResourceScore(const Village& village) {
-        float totalValue = 0.0f;
-        for (const auto& [type, quantity] : village.resources) {
-            totalValue += quantity * getResourceValue(type);
-        }
+        float totalValue = dot(village.resources, ResourceValues);
         
         return std::min(1.0f, totalValue / 10000.0f);
     }
@@ -376,7 +410,7 @@ private:
         m_storySystem->addEvent(event);
     }
 
-    void spreadTechnology(const Village& source, const std::string& tech, float deltaTime) {
+    void spreadTechnology(const Village& source, ForgeEngine::Core::Symbol tech, float deltaTime) {
         for (auto& target : m_villages) {
             if (&target == &source) continue;
             
@@ -409,11 +443,11 @@ private:
 
     void generateTechnologySpreadEvent(const Village& source,
                                      const Village& target,
-                                     const std::string& tech) {
+                                     ForgeEngine::Core::Symbol tech) {
         ForgeEngine::AI::StoryEvent event{
             ForgeEngine::AI::StoryEvent::Type::Technological,
             "Technology Spreads",
-            target.name + " learns " + tech + " from " + source.name,
+            target.name + " learns " + tech.str() + " from " + source.name,
             0.6f,
             0.2f,
             {source.id, target.id},
@@ -445,15 +479,18 @@ private:
         return it != m_villages.end() ? &(*it) : nullptr;
     }
 
-    float getResourceValue(ResourceType type) {
-        switch (type) {
-            case ResourceType::Food: return 1.0f;
-            case ResourceType::Wood: return 2.0f;
-            case ResourceType::Stone: return 3.0f;
-            case ResourceType::Metal: return 5.0f;
-            case ResourceType::Tools: return 8.0f;
-            default: return 1.0f;
-        }
+    // Trade value of one unit of each resource
+    static constexpr ResourceArray<float> ResourceValues{
+        {ResourceType::Food, 1.0f},
+        {ResourceType::Wood, 2.0f},
+        {ResourceType::Stone, 3.0f},
+        {ResourceType::Metal, 5.0f},
+        {ResourceType::Cloth, 1.0f},
+        {ResourceType::Tools, 8.0f}
+    };
+
+    static constexpr float getResourceValue(ResourceType type) {
+        return ResourceValues[type];
     }
 
     std::string generateUniqueId() {
@@ -1,45 +1,108 @@
 #include "NPCAISystem.h"
-#include "NPCAdvanced.h"
 #include <algorithm>
 #include <cmath>
 
 namespace Forge {
 
-NPCAISystem::NPCAISystem() : 
-    m_randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()) {}
+using ForgeEngine::Core::BehaviorBlackboard;
+using ForgeEngine::Core::BehaviorStatus;
 
-void NPCAISystem::UpdateNPCAI(AdvancedNPC* npc, float deltaTime) {
-    if (!npc) return;
+namespace NPCActions {
 
-    // Create decision context
-    DecisionContext context{
-        npc->GetTimeOfDay(),
-        npc->GetHunger(),
-        npc->GetEnergy(),
-        npc->GetSocialNeed(),
-        npc->GetWorkMotivation(),
-        GetPersonality(npc)
-    };
+void Rest(NPCAgent& npc) {
+    // Increase energy, decrease hunger
+    float& energy = npc.needs.energy();
+    float& hunger = npc.needs.hunger();
+    energy = std::min(1.0f, energy + 0.1f);
+    hunger = std::max(0.0f, hunger - 0.05f);
+}
+
+void FindFood(NPCAgent& npc) {
+    // Simulate food finding behavior
+    npc.memory.Record(NPCMemoryEvents::SearchingForFood);
+}
+
+void Eat(NPCAgent& npc) {
+    // Reduce hunger, slightly decrease energy
+    float& energy = npc.needs.energy();
+    npc.needs.hunger() = 0.0f;
+    energy = std::max(0.5f, energy - 0.1f);
+    npc.memory.Record(NPCMemoryEvents::AteMeal);
+}
+
+void FindWorkLocation(NPCAgent& npc) {
+    // Simulate work location finding
+    npc.memory.Record(NPCMemoryEvents::LookingForWork);
+}
+
+void PerformWork(NPCAgent& npc) {
+    // Decrease energy, increase work motivation
+    float& energy = npc.needs.energy();
+    float& workMotivation = npc.needs.workMotivation();
+    energy = std::max(0.0f, energy - 0.2f);
+    workMotivation = std::min(1.0f, workMotivation + 0.1f);
+    npc.memory.Record(NPCMemoryEvents::CompletedWork);
+}
+
+void FindSocialPartner(NPCAgent& npc) {
+    // Simulate social interaction search
+    npc.memory.Record(NPCMemoryEvents::SeekingSocial);
+}
+
+void Interact(NPCAgent& npc) {
+    // Reduce social need, slightly decrease energy
+    float& socialNeed = npc.needs.socialNeed();
+    float& energy = npc.needs.energy();
+    socialNeed = std::max(0.0f, socialNeed - 0.2f);
+    energy = std::max(0.5f, energy - 0.1f);
+    npc.memory.Record(NPCMemoryEvents::Socialized);
+}
+
+void Wander(NPCAgent& npc) {
+    // Random wandering behavior
+    npc.memory.Record(NPCMemoryEvents::Wandering);
+}
+
+} // namespace NPCActions
 
+NPCAISystem::NPCAISystem() : 
+    m_randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()) {
+    BuildBehaviorTrees();
+}
+
+void NPCAISystem::UpdateNPCAI(NPCAgent& npc, NPCPersonality personality, NPCState& state,
+                              BehaviorBlackboard& blackboard, float deltaTime) {
     // Determine next state
-    NPCState nextState = DetermineNextState(npc);
-    npc->SetCurrentState(nextState);
+    state = DetermineNextState(npc.needs, personality);
+
+    // Execute the state's shared behavior tree
+    GetBehaviorTree(state).execute(npc, blackboard);
+}
 
-    // Create and execute behavior tree
-    auto behaviorTree = CreateBehaviorTree(npc);
-    behaviorTree->Execute(npc);
+void NPCAISystem::Update(ForgeEngine::Core::World& world, float deltaTime) {
+    world.query<const NPCNeedsRef, const NPCPersonality, NPCState, NPCMemory, BehaviorBlackboard>().forEach(
+        [this, deltaTime](const NPCNeedsRef& needs, const NPCPersonality& personality, NPCState& state,
+                          NPCMemory& memory, BehaviorBlackboard& blackboard) {
+            NPCAgent npc{needs, memory};
+            UpdateNPCAI(npc, personality, state, blackboard, deltaTime);
+        });
 }
 
-void NPCAISystem::SetPersonality(AdvancedNPC* npc, NPCPersonality personality) {
-    if (npc) {
-        m_npcPersonalities[npc] = personality;
+const NPCBehaviorTree& NPCAISystem::GetBehaviorTree(NPCState state) const {
+    return *m_behaviorTrees[static_cast<size_t>(state)];
+}
+
+void NPCAISystem::SetPersonality(ForgeEngine::Core::World& world, ForgeEngine::Core::Entity npc,
+                                 NPCPersonality personality) {
+    if (world.alive(npc)) {
+        world.add<NPCPersonality>(npc, personality);
     }
 }
 
-NPCPersonality NPCAISystem::GetPersonality(AdvancedNPC* npc) const {
-    auto it = m_npcPersonalities.find(npc);
-    return (it != m_npcPersonalities.end()) ? 
-        it->second : NPCPersonality::Passive;
+NPCPersonality NPCAISystem::GetPersonality(const ForgeEngine::Core::World& world,
+                                           ForgeEngine::Core::Entity npc) const {
+    const NPCPersonality* personality = world.get<NPCPersonality>(npc);
+    return personality ? *personality : NPCPersonality::Passive;
 }
 
 float NPCAISystem::CalculateDecisionWeight(const DecisionContext& context) {
@@ -83,16 +146,14 @@ float NPCAISystem::CalculateDecisionWeight(const DecisionContext& context) {
     return std::clamp(weight, 0.0f, 1.0f);
 }
 
-NPCState NPCAISystem::DetermineNextState(AdvancedNPC* npc) {
-    if (!npc) return NPCState::Idle;
-
+NPCState NPCAISystem::DetermineNextState(const NPCNeedsRef& needs, NPCPersonality personality) {
     DecisionContext context{
-        npc->GetTimeOfDay(),
-        npc->GetHunger(),
-        npc->GetEnergy(),
-        npc->GetSocialNeed(),
-        npc->GetWorkMotivation(),
-        GetPersonality(npc)
+        m_timeOfDay,
+        needs.hunger(),
+        needs.energy(),
+        needs.socialNeed(),
+        needs.workMotivation(),
+        personality
     };
 
     float decisionWeight = CalculateDecisionWeight(context);
@@ -126,61 +187,54 @@ NPCState NPCAISystem::DetermineNextState(AdvancedNPC* npc) {
     return NPCState::Idle;
 }
 
-std::unique_ptr<BehaviorTreeNode> NPCAISystem::CreateBehaviorTree(AdvancedNPC* npc) {
-    auto rootSequence = std::make_unique<SequenceNode>();
-
-    // Basic action nodes based on current state
-    switch (npc->GetCurrentState()) {
-        case NPCState::Sleeping:
-            rootSequence->AddChild(std::make_unique<ActionNode>(
-                [](AdvancedNPC* n) { 
-                    n->Rest(); 
-                    return true; 
-                }
-            ));
-            break;
-
-        case NPCState::Eating:
-            rootSequence->AddChild(std::make_unique<ActionNode>(
-                [](AdvancedNPC* n) { 
-                    n->FindFood(); 
-                    n->Eat(); 
-                    return true; 
-                }
-            ));
-            break;
-
-        case NPCState::Working:
-            rootSequence->AddChild(std::make_unique<ActionNode>(
-                [](AdvancedNPC* n) { 
-                    n->FindWorkLocation(); 
-                    n->PerformWork(); 
-                    return true; 
-                }
-            ));
-            break;
-
-        case NPCState::Socializing:
-            rootSequence->AddChild(std::make_unique<ActionNode>(
-                [](AdvancedNPC* n) { 
-                    n->FindSocialPartner(); 
-                    n->Interact(); 
-                    return true; 
-                }
-            ));
-            break;
+void NPCAISystem::BuildBehaviorTrees() {
+    auto makeTree = [](NPCActionNode::Function action) {
+        auto rootSequence = std::make_unique<NPCSequenceNode>();
+        rootSequence->add(std::make_unique<NPCActionNode>(action));
+        return std::make_unique<const NPCBehaviorTree>(std::move(rootSequence));
+    };
 
-        default:
-            rootSequence->AddChild(std::make_unique<ActionNode>(
-                [](AdvancedNPC* n) { 
-                    n->Wander(); 
-                    return true; 
-                }
-            ));
-            break;
+    for (size_t state = 0; state < NPCStateCount; ++state) {
+        switch (static_cast<NPCState>(state)) {
+            case NPCState::Sleeping:
+                m_behaviorTrees[state] = makeTree([](NPCAgent& n, BehaviorBlackboard&) {
+                    NPCActions::Rest(n);
+                    return BehaviorStatus::Success;
+                });
+                break;
+
+            case NPCState::Eating:
+                m_behaviorTrees[state] = makeTree([](NPCAgent& n, BehaviorBlackboard&) {
+                    NPCActions::FindFood(n);
+                    NPCActions::Eat(n);
+                    return BehaviorStatus::Success;
+                });
+                break;
+
+            case NPCState::Working:
+                m_behaviorTrees[state] = makeTree([](NPCAgent& n, BehaviorBlackboard&) {
+                    NPCActions::FindWorkLocation(n);
+                    NPCActions::PerformWork(n);
+                    return BehaviorStatus::Success;
+                });
+                break;
+
+            case NPCState::Socializing:
+                m_behaviorTrees[state] = makeTree([](NPCAgent& n, BehaviorBlackboard&) {
+                    NPCActions::FindSocialPartner(n);
+                    NPCActions::Interact(n);
+                    return BehaviorStatus::Success;
+                });
+                break;
+
+            default:
+                m_behaviorTrees[state] = makeTree([](NPCAgent& n, BehaviorBlackboard&) {
+                    NPCActions::Wander(n);
+                    return BehaviorStatus::Success;
+                });
+                break;
+        }
     }
-
-    return rootSequence;
 }
 
 } // namespace Forge
@@ -1,10 +1,17 @@
 #pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <vector>
 #include <unordered_map>
-#include <functional>
 #include <random>
 #include <chrono>
+#include "../Core/BehaviorTree.h"
+#include "../Core/ECS.h"
+#include "../Core/Symbol.h"
+#include "NPCNeeds.h"
 
 namespace Forge {
 
@@ -22,6 +29,8 @@ enum class NPCState {
     Sleeping
 };
 
+inline constexpr size_t NPCStateCount = 7;
+
 // Enum for NPC personalities
 enum class NPCPersonality {
     Introvert,
@@ -32,15 +41,6 @@ enum class NPCPersonality {
     Cautious
 };
 
-// Behavior Tree Node Types
-enum class BehaviorNodeType {
-    Sequence,
-    Selector,
-    Condition,
-    Action,
-    Parallel
-};
-
 // Decision Weights and Probabilities
 struct DecisionContext {
     float timeOfDay;
@@ -51,75 +51,113 @@ struct DecisionContext {
     NPCPersonality personality;
 };
 
-class BehaviorTreeNode {
-public:
-    virtual bool Execute(AdvancedNPC* npc) = 0;
-    virtual BehaviorNodeType GetType() const = 0;
-    virtual ~BehaviorTreeNode() = default;
+// Components of an NPC entity in NPCManager's world. The per-tick systems
+// iterate NPCNeedsRef, NPCPersonality, NPCState, NPCMemory,
+// BehaviorBlackboard and EmotionalState; NPCComponent keeps the rest of the
+// NPC (name, ID, traits, relationships) for lookups and is not touched by
+// them.
+struct NPCComponent {
+    std::unique_ptr<AdvancedNPC> npc;
 };
 
-class ActionNode : public BehaviorTreeNode {
+// The last events an NPC took part in, oldest first. A fixed array of
+// interned symbols, so recording never allocates; once full, the oldest is
+// evicted by shifting the rest down, which keeps GetRecent() one span.
+class NPCMemory {
 public:
-    using ActionFunction = std::function<bool(AdvancedNPC*)>;
-    
-    ActionNode(ActionFunction action) : m_action(action) {}
-    
-    bool Execute(AdvancedNPC* npc) override {
-        return m_action(npc);
-    }
-    
-    BehaviorNodeType GetType() const override { 
-        return BehaviorNodeType::Action; 
-    }
+    static constexpr size_t Capacity = 20;
 
-private:
-    ActionFunction m_action;
-};
-
-class SequenceNode : public BehaviorTreeNode {
-public:
-    void AddChild(std::unique_ptr<BehaviorTreeNode> child) {
-        m_children.push_back(std::move(child));
-    }
-
-    bool Execute(AdvancedNPC* npc) override {
-        for (auto& child : m_children) {
-            if (!child->Execute(npc)) {
-                return false;
-            }
+    void Record(ForgeEngine::Core::Symbol event) {
+        if (m_size == Capacity) {
+            std::copy(m_events.begin() + 1, m_events.end(), m_events.begin());
+            --m_size;
         }
-        return true;
+        m_events[m_size++] = event;
     }
 
-    BehaviorNodeType GetType() const override { 
-        return BehaviorNodeType::Sequence; 
+    std::span<const ForgeEngine::Core::Symbol> GetRecent(size_t count = 5) const {
+        const size_t recent = std::min(count, m_size);
+        return std::span<const ForgeEngine::Core::Symbol>(m_events).subspan(m_size - recent, recent);
     }
 
+    size_t Size() const { return m_size; }
+
 private:
-    std::vector<std::unique_ptr<BehaviorTreeNode>> m_children;
+    std::array<ForgeEngine::Core::Symbol, Capacity> m_events{};
+    size_t m_size = 0;
+};
+
+// Events the NPC actions record, interned once
+struct NPCMemoryEvents {
+    inline static const ForgeEngine::Core::Symbol SearchingForFood{"Searching for food"};
+    inline static const ForgeEngine::Core::Symbol AteMeal{"Ate a meal"};
+    inline static const ForgeEngine::Core::Symbol LookingForWork{"Looking for work"};
+    inline static const ForgeEngine::Core::Symbol CompletedWork{"Completed work task"};
+    inline static const ForgeEngine::Core::Symbol SeekingSocial{"Seeking social interaction"};
+    inline static const ForgeEngine::Core::Symbol Socialized{"Engaged in social interaction"};
+    inline static const ForgeEngine::Core::Symbol Wandering{"Wandering around"};
+};
+
+// What the NPC behavior trees act on: an NPC's needs and memory,
+// referenced straight from its entity's components
+struct NPCAgent {
+    NPCNeedsRef needs;
+    NPCMemory& memory;
 };
 
+// NPC actions run by the behavior trees
+namespace NPCActions {
+    void Rest(NPCAgent& npc);
+    void FindFood(NPCAgent& npc);
+    void Eat(NPCAgent& npc);
+    void FindWorkLocation(NPCAgent& npc);
+    void PerformWork(NPCAgent& npc);
+    void FindSocialPartner(NPCAgent& npc);
+    void Interact(NPCAgent& npc);
+    void Wander(NPCAgent& npc);
+}
+
+// Behavior trees over NPCs; immutable once built and shared by every NPC
+using NPCBehaviorTree = ForgeEngine::Core::BehaviorTree<NPCAgent>;
+using NPCActionNode = ForgeEngine::Core::ActionNode<NPCAgent>;
+using NPCSequenceNode = ForgeEngine::Core::SequenceNode<NPCAgent>;
+
 class NPCAISystem {
 public:
     NPCAISystem();
 
-    // Core AI Decision Making
-    void UpdateNPCAI(AdvancedNPC* npc, float deltaTime);
+    // Core AI Decision Making; picks the NPC's next state and runs that
+    // state's shared tree with the NPC's own blackboard
+    void UpdateNPCAI(NPCAgent& npc, NPCPersonality personality, NPCState& state,
+                     ForgeEngine::Core::BehaviorBlackboard& blackboard, float deltaTime);
+
+    // Runs UpdateNPCAI for every NPC entity in the world
+    void Update(ForgeEngine::Core::World& world, float deltaTime);
 
-    // Personality and Trait Management
-    void SetPersonality(AdvancedNPC* npc, NPCPersonality personality);
-    NPCPersonality GetPersonality(AdvancedNPC* npc) const;
+    // Hour of the day, 0 to 24, that every NPC schedules around
+    void SetTimeOfDay(float hour) { m_timeOfDay = hour; }
+    float GetTimeOfDay() const { return m_timeOfDay; }
+
+    // Personality and Trait Management; stored as an NPCPersonality component
+    void SetPersonality(ForgeEngine::Core::World& world, ForgeEngine::Core::Entity npc,
+                        NPCPersonality personality);
+    NPCPersonality GetPersonality(const ForgeEngine::Core::World& world,
+                                  ForgeEngine::Core::Entity npc) const;
 
     // Decision Making Utilities
     float CalculateDecisionWeight(const DecisionContext& context);
 
+    // Built once in the constructor; the same tree for every NPC in state
+    const NPCBehaviorTree& GetBehaviorTree(NPCState state) const;
+
 private:
     std::mt19937 m_randomGenerator;
-    std::unordered_map<AdvancedNPC*, NPCPersonality> m_npcPersonalities;
+    float m_timeOfDay = 12.0f;
+    std::array<std::unique_ptr<const NPCBehaviorTree>, NPCStateCount> m_behaviorTrees;
 
     // AI Decision Making Helpers
-    NPCState DetermineNextState(AdvancedNPC* npc);
-    std::unique_ptr<BehaviorTreeNode> CreateBehaviorTree(AdvancedNPC* npc);
+    NPCState DetermineNextState(const NPCNeedsRef& needs, NPCPersonality personality);
+    void BuildBehaviorTrees();
 };
 
 } // namespace Forge
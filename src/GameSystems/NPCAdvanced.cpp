@@ -1,8 +1,10 @@
 #include "NPCAdvanced.h"
+#include "../AI/EmotionalSystem.h"
 #include <algorithm>
 #include <cmath>
 #include <random>
 #include <chrono>
+#include <utility>
 
 namespace Forge {
 
@@ -37,7 +39,7 @@ bool AdvancedNPC::Memory::HasTraumaticEvent() const {
 
 // Relationship Graph Implementation
 void AdvancedNPC::RelationshipGraph::ModifyRelationship(
-    const std::string& npcId, 
+    ForgeEngine::Core::EntityId npcId, 
     RelationshipType type, 
     float value
 ) {
@@ -50,131 +52,85 @@ void AdvancedNPC::RelationshipGraph::ModifyRelationship(
 }
 
 RelationshipType AdvancedNPC::RelationshipGraph::GetRelationship(
-    const std::string& npcId
+    ForgeEngine::Core::EntityId npcId
 ) const {
-    auto it = m_relationships.find(npcId);
-    return it != m_relationships.end() ? it->second.first : RelationshipType::Stranger;
+    auto* relationship = m_relationships.find(npcId);
+    return relationship ? relationship->first : RelationshipType::Stranger;
 }
 
 float AdvancedNPC::RelationshipGraph::GetRelationshipStrength(
-    const std::string& npcId
+    ForgeEngine::Core::EntityId npcId
 ) const {
-    auto it = m_relationships.find(npcId);
-    return it != m_relationships.end() ? it->second.second : 0.0f;
+    auto* relationship = m_relationships.find(npcId);
+    return relationship ? relationship->second : 0.0f;
 }
 
 // Advanced NPC Implementation
-AdvancedNPC::AdvancedNPC(const std::string& name, const NPCTraits& traits) :
+AdvancedNPC::AdvancedNPC(const std::string& name, const NPCTraits& traits,
+                         NPCNeedsStorage& needsStorage) :
     m_name(name),
+    m_id(ForgeEngine::Core::EntityRegistry::global().acquire(name)),
     m_traits(traits),
-    m_currentState(NPCState::Idle),
-    m_timeOfDay(12.0f),
-    m_hunger(0.0f),
-    m_energy(1.0f),
-    m_socialNeed(0.0f),
-    m_workMotivation(0.5f) {}
-
-void AdvancedNPC::Rest() {
-    // Increase energy, decrease hunger
-    m_energy = std::min(1.0f, m_energy + 0.1f);
-    m_hunger = std::max(0.0f, m_hunger - 0.05f);
-}
-
-void AdvancedNPC::FindFood() {
-    // Simulate food finding behavior
-    RecordMemory("Searching for food");
-}
-
-void AdvancedNPC::Eat() {
-    // Reduce hunger, slightly decrease energy
-    m_hunger = 0.0f;
-    m_energy = std::max(0.5f, m_energy - 0.1f);
-    RecordMemory("Ate a meal");
-}
-
-void AdvancedNPC::FindWorkLocation() {
-    // Simulate work location finding
-    RecordMemory("Looking for work");
-}
-
-void AdvancedNPC::PerformWork() {
-    // Decrease energy, increase work motivation
-    m_energy = std::max(0.0f, m_energy - 0.2f);
-    m_workMotivation = std::min(1.0f, m_workMotivation + 0.1f);
-    RecordMemory("Completed work task");
-}
+    m_needs(&needsStorage),
+    m_needsSlot(needsStorage.allocate()) {}
 
-void AdvancedNPC::FindSocialPartner() {
-    // Simulate social interaction search
-    RecordMemory("Seeking social interaction");
-}
-
-void AdvancedNPC::Interact() {
-    // Reduce social need, slightly decrease energy
-    m_socialNeed = std::max(0.0f, m_socialNeed - 0.2f);
-    m_energy = std::max(0.5f, m_energy - 0.1f);
-    RecordMemory("Engaged in social interaction");
+AdvancedNPC::~AdvancedNPC() {
+    if (m_needs) {
+        m_needs->release(m_needsSlot);
+    }
+    if (m_id != ForgeEngine::Core::InvalidEntityId) {
+        ForgeEngine::Core::EntityRegistry::global().release(m_id);
+    }
 }
 
-void AdvancedNPC::Wander() {
-    // Random wandering behavior
-    RecordMemory("Wandering around");
-}
+AdvancedNPC::AdvancedNPC(AdvancedNPC&& other) noexcept :
+    m_name(std::move(other.m_name)),
+    m_id(std::exchange(other.m_id, ForgeEngine::Core::InvalidEntityId)),
+    m_traits(other.m_traits),
+    m_needs(std::exchange(other.m_needs, nullptr)),
+    m_needsSlot(other.m_needsSlot),
+    m_relationships(std::move(other.m_relationships)) {}
 
-void AdvancedNPC::RecordMemory(const std::string& event) {
-    m_memories.push_back(event);
-    
-    // Limit memory size
-    if (m_memories.size() > MAX_MEMORIES) {
-        m_memories.erase(m_memories.begin());
+AdvancedNPC& AdvancedNPC::operator=(AdvancedNPC&& other) noexcept {
+    if (this != &other) {
+        if (m_needs) {
+            m_needs->release(m_needsSlot);
+        }
+        if (m_id != ForgeEngine::Core::InvalidEntityId) {
+            ForgeEngine::Core::EntityRegistry::global().release(m_id);
+        }
+        m_name = std::move(other.m_name);
+        m_id = std::exchange(other.m_id, ForgeEngine::Core::InvalidEntityId);
+        m_traits = other.m_traits;
+        m_needs = std::exchange(other.m_needs, nullptr);
+        m_needsSlot = other.m_needsSlot;
+        m_relationships = std::move(other.m_relationships);
     }
+    return *this;
 }
 
-std::vector<std::string> AdvancedNPC::GetRecentMemories(int count) const {
-    int start = std::max(0, static_cast<int>(m_memories.size()) - count);
-    return std::vector<std::string>(
-        m_memories.begin() + start, 
-        m_memories.end()
-    );
-}
+void AdvancedNPC::UpdateRelationship(ForgeEngine::Core::EntityId npcId, float change) {
+    float& strength = m_relationships[npcId];
 
-void AdvancedNPC::UpdateRelationship(const std::string& npcName, float change) {
-    m_relationships[npcName] += change;
-    
     // Clamp relationship strength
-    m_relationships[npcName] = std::clamp(m_relationships[npcName], -1.0f, 1.0f);
+    strength = std::clamp(strength + change, -1.0f, 1.0f);
 }
 
-float AdvancedNPC::GetRelationshipStrength(const std::string& npcName) const {
-    auto it = m_relationships.find(npcName);
-    return (it != m_relationships.end()) ? it->second : 0.0f;
-}
-
-void AdvancedNPC::UpdateNeeds(float deltaTime) {
-    // Gradually increase needs
-    m_hunger += 0.01f * deltaTime;
-    m_socialNeed += 0.005f * deltaTime;
-    m_workMotivation -= 0.002f * deltaTime;
-
-    // Decrease energy over time
-    m_energy -= 0.005f * deltaTime;
-
-    // Clamp values
-    m_hunger = std::clamp(m_hunger, 0.0f, 1.0f);
-    m_energy = std::clamp(m_energy, 0.0f, 1.0f);
-    m_socialNeed = std::clamp(m_socialNeed, 0.0f, 1.0f);
-    m_workMotivation = std::clamp(m_workMotivation, 0.0f, 1.0f);
+float AdvancedNPC::GetRelationshipStrength(ForgeEngine::Core::EntityId npcId) const {
+    const float* strength = m_relationships.find(npcId);
+    return strength ? *strength : 0.0f;
 }
 
 void AdvancedNPC::DecayRelationships(float deltaTime) {
     // Gradually decay relationship strengths
-    for (auto& relationship : m_relationships) {
-        relationship.second *= std::pow(0.99f, deltaTime);
-    }
+    const float decay = std::pow(0.99f, deltaTime);
+    m_relationships.forEach([decay](ForgeEngine::Core::EntityId, float& strength) {
+        strength *= decay;
+    });
 }
 
 void AdvancedNPC::Update(float deltaTime) {
-    UpdateNeeds(deltaTime);
+    // Needs are advanced for every NPC at once by NPCNeedsStorage::advance()
     DecayRelationships(deltaTime);
 }
 
@@ -260,27 +216,65 @@ void EventTracker::GenerateConsequences() {
     }
 }
 
-void NPCManager::AddNPC(std::unique_ptr<AdvancedNPC> npc) {
-    if (npc) {
-        m_npcs[npc->GetName()] = std::move(npc);
+ForgeEngine::Core::Entity NPCManager::AddNPC(std::unique_ptr<AdvancedNPC> npc,
+                                             NPCPersonality personality) {
+    if (!npc) {
+        return {};
     }
+    RemoveNPC(npc->GetName());
+    const std::string name = npc->GetName();
+    const NPCNeedsRef needs = npc->GetNeeds();
+    const auto entity = m_world.create(NPCComponent{std::move(npc)}, needs, personality,
+                                       NPCState::Idle, NPCMemory{},
+                                       ForgeEngine::Core::BehaviorBlackboard{},
+                                       ForgeEngine::AI::EmotionalState{});
+    m_entitiesByName[name] = entity;
+    return entity;
 }
 
 void NPCManager::RemoveNPC(const std::string& name) {
-    m_npcs.erase(name);
+    auto it = m_entitiesByName.find(name);
+    if (it != m_entitiesByName.end()) {
+        m_world.destroy(it->second);
+        m_entitiesByName.erase(it);
+    }
 }
 
 AdvancedNPC* NPCManager::GetNPC(const std::string& name) {
-    auto it = m_npcs.find(name);
-    return (it != m_npcs.end()) ? it->second.get() : nullptr;
+    auto* component = m_world.get<NPCComponent>(GetEntity(name));
+    return component ? component->npc.get() : nullptr;
+}
+
+ForgeEngine::Core::Entity NPCManager::GetEntity(const std::string& name) const {
+    auto it = m_entitiesByName.find(name);
+    return (it != m_entitiesByName.end()) ? it->second : ForgeEngine::Core::Entity{};
 }
 
 std::vector<AdvancedNPC*> NPCManager::GetAllNPCs() {
     std::vector<AdvancedNPC*> npcs;
-    for (auto& pair : m_npcs) {
-        npcs.push_back(pair.second.get());
-    }
+    npcs.reserve(m_world.size());
+    m_world.query<NPCComponent>().forEach([&npcs](NPCComponent& component) {
+        npcs.push_back(component.npc.get());
+    });
+    return npcs;
+}
+
+std::pmr::vector<AdvancedNPC*> NPCManager::GetAllNPCs(std::pmr::memory_resource* resource) {
+    std::pmr::vector<AdvancedNPC*> npcs(resource);
+    npcs.reserve(m_world.size());
+    m_world.query<NPCComponent>().forEach([&npcs](NPCComponent& component) {
+        npcs.push_back(component.npc.get());
+    });
     return npcs;
 }
 
+void NPCManager::Update(float deltaTime) {
+    m_aiSystem.Update(m_world, deltaTime);
+
+    m_world.query<ForgeEngine::AI::EmotionalState>().forEach(
+        [deltaTime](ForgeEngine::AI::EmotionalState& emotions) {
+            emotions.updateEmotions(deltaTime, {});
+        });
+}
+
 } // namespace Forge
@@ -2,8 +2,13 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <unordered_map>
 #include "NPCAISystem.h"
+#include "NPCNeeds.h"
+#include "../Core/ECS.h"
+#include "../Core/EntityRegistry.h"
+#include "../Core/IdMap.h"
 
 namespace Forge {
 
@@ -57,63 +62,48 @@ namespace Forge {
     // Advanced NPC Class
     class AdvancedNPC {
     public:
-        AdvancedNPC(const std::string& name, const NPCTraits& traits);
+        // Needs live in needsStorage, which must outlive the NPC
+        AdvancedNPC(const std::string& name, const NPCTraits& traits,
+                    NPCNeedsStorage& needsStorage = NPCNeedsStorage::shared());
+        ~AdvancedNPC();
+
+        AdvancedNPC(const AdvancedNPC&) = delete;
+        AdvancedNPC& operator=(const AdvancedNPC&) = delete;
+        AdvancedNPC(AdvancedNPC&& other) noexcept;
+        AdvancedNPC& operator=(AdvancedNPC&& other) noexcept;
 
         // Core NPC Management
         std::string GetName() const { return m_name; }
+        // Registered in EntityRegistry::global() for the NPC's lifetime
+        ForgeEngine::Core::EntityId GetId() const { return m_id; }
         NPCTraits GetTraits() const { return m_traits; }
 
-        // State and Personality Management
-        void SetCurrentState(NPCState state) { m_currentState = state; }
-        NPCState GetCurrentState() const { return m_currentState; }
-
         // Needs and Motivation Tracking
-        float GetTimeOfDay() const { return m_timeOfDay; }
-        float GetHunger() const { return m_hunger; }
-        float GetEnergy() const { return m_energy; }
-        float GetSocialNeed() const { return m_socialNeed; }
-        float GetWorkMotivation() const { return m_workMotivation; }
-
-        // AI Behavior Methods
-        void Rest();
-        void FindFood();
-        void Eat();
-        void FindWorkLocation();
-        void PerformWork();
-        void FindSocialPartner();
-        void Interact();
-        void Wander();
-
-        // Memory and Learning System
-        void RecordMemory(const std::string& event);
-        std::vector<std::string> GetRecentMemories(int count = 5) const;
+        NPCNeedsRef GetNeeds() const { return {m_needs, m_needsSlot}; }
+        float GetHunger() const { return m_needs->hunger(m_needsSlot); }
+        float GetEnergy() const { return m_needs->energy(m_needsSlot); }
+        float GetSocialNeed() const { return m_needs->socialNeed(m_needsSlot); }
+        float GetWorkMotivation() const { return m_needs->workMotivation(m_needsSlot); }
 
         // Relationship Management
-        void UpdateRelationship(const std::string& npcName, float change);
-        float GetRelationshipStrength(const std::string& npcName) const;
+        void UpdateRelationship(ForgeEngine::Core::EntityId npcId, float change);
+        float GetRelationshipStrength(ForgeEngine::Core::EntityId npcId) const;
 
     private:
         // Core NPC Attributes
         std::string m_name;
+        ForgeEngine::Core::EntityId m_id;
         NPCTraits m_traits;
-        NPCState m_currentState;
-
-        // Needs and Motivation Variables
-        float m_timeOfDay;
-        float m_hunger;
-        float m_energy;
-        float m_socialNeed;
-        float m_workMotivation;
 
-        // Memory System
-        std::vector<std::string> m_memories;
-        static const int MAX_MEMORIES = 20;
+        // Hunger, energy, social need and work motivation, advanced for all
+        // NPCs at once by NPCNeedsStorage::advance()
+        NPCNeedsStorage* m_needs;
+        uint32_t m_needsSlot;
 
-        // Relationship Tracking
-        std::unordered_map<std::string, float> m_relationships;
+        // Relationship Tracking, keyed by the other NPC's ID
+        ForgeEngine::Core::IdMap<float> m_relationships;
 
         // Internal Update Methods
-        void UpdateNeeds(float deltaTime);
         void DecayRelationships(float deltaTime);
     };
 
@@ -151,15 +141,29 @@ namespace Forge {
         std::vector<PlayerAction> m_actions;
     };
 
+    // Each NPC is an entity with NPCComponent, NPCNeedsRef, NPCPersonality,
+    // NPCState, NPCMemory, BehaviorBlackboard and EmotionalState components;
+    // systems iterate the columns they need instead of looking NPCs up by
+    // name or going through the AdvancedNPC.
     class NPCManager {
     public:
-        void AddNPC(std::unique_ptr<AdvancedNPC> npc);
+        ForgeEngine::Core::Entity AddNPC(std::unique_ptr<AdvancedNPC> npc,
+                                         NPCPersonality personality = NPCPersonality::Passive);
         void RemoveNPC(const std::string& name);
         AdvancedNPC* GetNPC(const std::string& name);
+        ForgeEngine::Core::Entity GetEntity(const std::string& name) const;
         std::vector<AdvancedNPC*> GetAllNPCs();
+        std::pmr::vector<AdvancedNPC*> GetAllNPCs(std::pmr::memory_resource* resource);
+
+        // AI decisions and emotional decay for every NPC
+        void Update(float deltaTime);
+        void SetTimeOfDay(float hour) { m_aiSystem.SetTimeOfDay(hour); }
+
+        ForgeEngine::Core::World& GetWorld() { return m_world; }
 
     private:
-        std::unordered_map<std::string, std::unique_ptr<AdvancedNPC>> m_npcs;
+        ForgeEngine::Core::World m_world;
+        std::unordered_map<std::string, ForgeEngine::Core::Entity> m_entitiesByName;  // lookups by name only
         NPCAISystem m_aiSystem;
     };
 
@@ -0,0 +1,148 @@
+#include "NPCNeeds.h"
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+namespace Forge {
+
+namespace {
+
+static_assert(NPCNeedsStorage::PageSlots % NPCNeedsStorage::Lanes == 0,
+              "the kernel runs whole lanes over a page");
+
+#if defined(__AVX__)
+inline void advanceLanes(float* values, __m256 step, __m256 zero, __m256 one) {
+    __m256 a = _mm256_add_ps(_mm256_load_ps(values), step);
+    __m256 b = _mm256_add_ps(_mm256_load_ps(values + 8), step);
+    _mm256_store_ps(values, _mm256_min_ps(_mm256_max_ps(a, zero), one));
+    _mm256_store_ps(values + 8, _mm256_min_ps(_mm256_max_ps(b, zero), one));
+}
+
+void advanceNeed(float* values, size_t count, float step) {
+    const __m256 steps = _mm256_set1_ps(step);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for (size_t i = 0; i < count; i += NPCNeedsStorage::Lanes) {
+        advanceLanes(values + i, steps, zero, one);
+    }
+}
+#elif defined(__SSE2__) || defined(_M_X64)
+void advanceNeed(float* values, size_t count, float step) {
+    const __m128 steps = _mm_set1_ps(step);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (size_t i = 0; i < count; i += NPCNeedsStorage::Lanes) {
+        for (size_t lane = 0; lane < NPCNeedsStorage::Lanes; lane += 4) {
+            const __m128 v = _mm_add_ps(_mm_load_ps(values + i + lane), steps);
+            _mm_store_ps(values + i + lane, _mm_min_ps(_mm_max_ps(v, zero), one));
+        }
+    }
+}
+#else
+void advanceNeed(float* values, size_t count, float step) {
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = std::min(std::max(values[i] + step, 0.0f), 1.0f);
+    }
+}
+#endif
+
+} // namespace
+
+void AdvanceNeeds(float* hunger, float* energy, float* socialNeed, float* workMotivation,
+                  size_t count, float deltaTime) {
+    // One array at a time keeps each pass a single sequential stream
+    advanceNeed(hunger, count, NeedRates::Hunger * deltaTime);
+    advanceNeed(energy, count, NeedRates::Energy * deltaTime);
+    advanceNeed(socialNeed, count, NeedRates::SocialNeed * deltaTime);
+    advanceNeed(workMotivation, count, NeedRates::WorkMotivation * deltaTime);
+}
+
+void AdvanceNeedsScalar(float* hunger, float* energy, float* socialNeed, float* workMotivation,
+                        size_t count, float deltaTime) {
+    for (size_t i = 0; i < count; ++i) {
+        hunger[i] = std::clamp(hunger[i] + NeedRates::Hunger * deltaTime, 0.0f, 1.0f);
+        energy[i] = std::clamp(energy[i] + NeedRates::Energy * deltaTime, 0.0f, 1.0f);
+        socialNeed[i] = std::clamp(socialNeed[i] + NeedRates::SocialNeed * deltaTime, 0.0f, 1.0f);
+        workMotivation[i] = std::clamp(workMotivation[i] + NeedRates::WorkMotivation * deltaTime, 0.0f, 1.0f);
+    }
+}
+
+NPCNeedsStorage& NPCNeedsStorage::shared() {
+    static NPCNeedsStorage storage;
+    return storage;
+}
+
+uint32_t NPCNeedsStorage::allocate() {
+    std::unique_lock lock(m_mutex);
+    uint32_t slot;
+    if (!m_freeSlots.empty()) {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        if (m_highWater == m_pageCount * PageSlots) {
+            if (m_pageCount == MaxPages) {
+                throw std::length_error("NPCNeedsStorage: out of slots");
+            }
+            // Zeroed so the kernel never clamps garbage in unused slots
+            m_pages[m_pageCount++] = std::make_unique<Page>();
+        }
+        slot = static_cast<uint32_t>(m_highWater++);
+    }
+    hunger(slot) = 0.0f;
+    energy(slot) = 1.0f;
+    socialNeed(slot) = 0.0f;
+    workMotivation(slot) = 0.5f;
+    return slot;
+}
+
+void NPCNeedsStorage::release(uint32_t slot) {
+    std::unique_lock lock(m_mutex);
+    m_freeSlots.push_back(slot);
+}
+
+size_t NPCNeedsStorage::size() const {
+    std::shared_lock lock(m_mutex);
+    return m_highWater - m_freeSlots.size();
+}
+
+size_t NPCNeedsStorage::capacity() const {
+    std::shared_lock lock(m_mutex);
+    return m_pageCount * PageSlots;
+}
+
+void NPCNeedsStorage::advance(float deltaTime, ForgeEngine::Core::ThreadPool* threadPool) {
+    // Pages added after this are first advanced next tick
+    size_t pageCount;
+    {
+        std::shared_lock lock(m_mutex);
+        pageCount = m_pageCount;
+    }
+
+    // The lock is taken per page, never across parallelFor: the caller may
+    // run other pool tasks while it waits, and those may allocate
+    if (threadPool && pageCount > 1) {
+        threadPool->parallelFor(size_t{0}, pageCount, 1, [this, deltaTime](size_t pageIndex) {
+            advancePage(pageIndex, deltaTime);
+        });
+    } else {
+        for (size_t pageIndex = 0; pageIndex < pageCount; ++pageIndex) {
+            advancePage(pageIndex, deltaTime);
+        }
+    }
+}
+
+void NPCNeedsStorage::advancePage(size_t pageIndex, float deltaTime) {
+    std::shared_lock lock(m_mutex);
+    // Whole kernel iterations; the padding past the high-water mark is ours
+    const size_t used = std::min(PageSlots, m_highWater - pageIndex * PageSlots);
+    const size_t count = (used + Lanes - 1) / Lanes * Lanes;
+    Page& page = *m_pages[pageIndex];
+    AdvanceNeeds(page.hunger, page.energy, page.socialNeed, page.workMotivation, count, deltaTime);
+}
+
+} // namespace Forge
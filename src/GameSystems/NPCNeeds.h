@@ -0,0 +1,112 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+#include "../Core/ThreadPool.h"
+
+namespace Forge {
+
+// Per-tick drift of each need, in units per second of simulation time
+struct NeedRates {
+    static constexpr float Hunger = 0.01f;
+    static constexpr float Energy = -0.005f;
+    static constexpr float SocialNeed = 0.005f;
+    static constexpr float WorkMotivation = -0.002f;
+};
+
+// Advances count NPCs' needs by deltaTime and clamps them to [0, 1]. The
+// arrays must be 64-byte aligned and padded to a multiple of
+// NPCNeedsStorage::Lanes. Uses AVX when the build targets it (FORGE_AVX2),
+// SSE2 otherwise, and plain loops on other architectures.
+void AdvanceNeeds(float* hunger, float* energy, float* socialNeed, float* workMotivation,
+                  size_t count, float deltaTime);
+
+// Reference kernel, one NPC and one scalar clamp at a time
+void AdvanceNeedsScalar(float* hunger, float* energy, float* socialNeed, float* workMotivation,
+                        size_t count, float deltaTime);
+
+// Structure-of-arrays storage for NPC needs: one aligned float array per
+// need, indexed by a slot each NPC holds for its lifetime. advance() runs
+// the SIMD kernel over every slot at once instead of each NPC clamping its
+// own four scalars.
+//
+// Slots live in pages of PageSlots that are allocated once and never move,
+// so an NPC may read and write its needs while another thread allocates.
+// allocate() and release() take the lock exclusively and advance() takes
+// it shared for each page, so a slot is never reset while the kernel runs
+// over it. Concurrent writes to the same slot, e.g. AI actions during
+// advance(), are still serialized through the "Needs" resource in the
+// scheduler.
+class NPCNeedsStorage {
+public:
+    // Floats per kernel iteration; capacity is always a multiple
+    static constexpr size_t Lanes = 16;
+    // Slots per page and per parallel task
+    static constexpr size_t PageSlots = 4096;
+    static constexpr size_t MaxPages = 1024;
+
+    NPCNeedsStorage() = default;
+    NPCNeedsStorage(const NPCNeedsStorage&) = delete;
+    NPCNeedsStorage& operator=(const NPCNeedsStorage&) = delete;
+
+    // Storage used by NPCs constructed without one
+    static NPCNeedsStorage& shared();
+
+    // Slot initialized to a rested, fed NPC. Throws std::length_error past
+    // MaxPages * PageSlots slots.
+    uint32_t allocate();
+    void release(uint32_t slot);
+
+    float& hunger(uint32_t slot) { return page(slot).hunger[slot % PageSlots]; }
+    float& energy(uint32_t slot) { return page(slot).energy[slot % PageSlots]; }
+    float& socialNeed(uint32_t slot) { return page(slot).socialNeed[slot % PageSlots]; }
+    float& workMotivation(uint32_t slot) { return page(slot).workMotivation[slot % PageSlots]; }
+
+    float hunger(uint32_t slot) const { return page(slot).hunger[slot % PageSlots]; }
+    float energy(uint32_t slot) const { return page(slot).energy[slot % PageSlots]; }
+    float socialNeed(uint32_t slot) const { return page(slot).socialNeed[slot % PageSlots]; }
+    float workMotivation(uint32_t slot) const { return page(slot).workMotivation[slot % PageSlots]; }
+
+    // Advances every slot, a page per task on threadPool when one is given.
+    // Free slots are advanced too; that is cheaper than skipping them.
+    void advance(float deltaTime, ForgeEngine::Core::ThreadPool* threadPool = nullptr);
+
+    size_t size() const;
+    size_t capacity() const;
+
+private:
+    struct alignas(64) Page {
+        float hunger[PageSlots];
+        float energy[PageSlots];
+        float socialNeed[PageSlots];
+        float workMotivation[PageSlots];
+    };
+
+    std::array<std::unique_ptr<Page>, MaxPages> m_pages;
+    size_t m_pageCount = 0;
+    size_t m_highWater = 0;   // slots ever handed out
+    std::vector<uint32_t> m_freeSlots;
+    mutable std::shared_mutex m_mutex;
+
+    Page& page(uint32_t slot) { return *m_pages[slot / PageSlots]; }
+    const Page& page(uint32_t slot) const { return *m_pages[slot / PageSlots]; }
+    void advancePage(size_t pageIndex, float deltaTime);
+};
+
+// An NPC's slot in an NPCNeedsStorage, copied into the NPC's entity so
+// systems reach its needs without going through the AdvancedNPC. The NPC
+// that allocated the slot still releases it.
+struct NPCNeedsRef {
+    NPCNeedsStorage* storage = nullptr;
+    uint32_t slot = 0;
+
+    float& hunger() const { return storage->hunger(slot); }
+    float& energy() const { return storage->energy(slot); }
+    float& socialNeed() const { return storage->socialNeed(slot); }
+    float& workMotivation() const { return storage->workMotivation(slot); }
+};
+
+} // namespace Forge
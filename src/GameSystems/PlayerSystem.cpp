@@ -32,6 +32,21 @@ std::vector<Item> Inventory::GetItemsByType(ItemType type) const {
     return filteredItems;
 }
 
+std::pmr::vector<const Item*> Inventory::GetItemsByType(ItemType type, std::pmr::memory_resource* resource) const {
+    std::pmr::vector<const Item*> filteredItems(resource);
+    for (const auto& item : m_items) {
+        if (item.type == type) {
+            filteredItems.push_back(&item);
+        }
+    }
+    return filteredItems;
+}
+
+int Inventory::CountItems(const std::string& itemName, ItemType type) const {
+    return static_cast<int>(std::count_if(m_items.begin(), m_items.end(),
+        [&itemName, type](const Item& item) { return item.type == type && item.name == itemName; }));
+}
+
 float Inventory::GetTotalWeight() const {
     return std::accumulate(m_items.begin(), m_items.end(), 0.0f,
         [](float total, const Item& item) { return total + item.weight; });
@@ -75,13 +90,7 @@ bool CraftingSystem::CanCraft(const Recipe& recipe, const Inventory& playerInven
 
     // Check required items
     for (const auto& requiredItem : recipe.requiredItems) {
-        int count = std::count_if(playerInventory.GetItemsByType(ItemType::Miscellaneous).begin(), 
-                                  playerInventory.GetItemsByType(ItemType::Miscellaneous).end(),
-                                  [&requiredItem](const Item& item) { 
-                                      return item.name == requiredItem.first; 
-                                  });
-        
-        if (count < requiredItem.second) {
+        if (playerInventory.CountItems(requiredItem.first, ItemType::Miscellaneous) < requiredItem.second) {
             return false;
         }
     }
@@ -3,6 +3,7 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
 #include <DirectXMath.h>
 
 namespace Forge {
@@ -85,6 +86,10 @@ namespace Forge {
         void RemoveItem(const std::string& itemName);
         bool HasItem(const std::string& itemName) const;
         std::vector<Item> GetItemsByType(ItemType type) const;
+        // Matching items without copying them; the vector lives in resource
+        std::pmr::vector<const Item*> GetItemsByType(ItemType type, std::pmr::memory_resource* resource) const;
+        // Items of the given name and type, counted in place
+        int CountItems(const std::string& itemName, ItemType type) const;
         float GetTotalWeight() const;
 
     private:
@@ -35,9 +35,9 @@ bool PopulationNPC::CanReproduce() const {
            m_age <= 45.0f;
 }
 
-PopulationNPC* PopulationNPC::Reproduce(PopulationNPC* partner) {
+PopulationHandle PopulationNPC::Reproduce(PopulationNPC* partner, PopulationPool& pool) {
     if (!CanReproduce() || !partner->CanReproduce()) {
-        return nullptr;
+        return {};
     }
 
     // Generate child's genetic traits
@@ -47,8 +47,7 @@ PopulationNPC* PopulationNPC::Reproduce(PopulationNPC* partner) {
     std::string childName = GetName() + "-" + partner->GetName() + 
                             std::to_string(std::rand() % 1000);
 
-    auto* child = new PopulationNPC(childName, childTraits);
-    return child;
+    return pool.create(childName, childTraits);
 }
 
 void PopulationNPC::LearnSkill(const std::string& skillName, float learningRate) {
@@ -67,8 +66,10 @@ void PopulationNPC::TrainDecisionModel(const std::vector<std::pair<std::string,
 }
 
 // PopulationManager Implementation
-PopulationManager::PopulationManager(int initialPopulation) : 
-    m_randomGenerator(std::random_device{}()) {
+PopulationManager::PopulationManager(int initialPopulation,
+                                     std::shared_ptr<ForgeEngine::Core::ThreadPool> threadPool) : 
+    m_randomGenerator(std::random_device{}()),
+    m_threadPool(std::move(threadPool)) {
     
     // Generate initial population
     std::uniform_real_distribution<> traitDist(0.5, 1.0);
@@ -82,17 +83,29 @@ PopulationManager::PopulationManager(int initialPopulation) :
             traitDist(m_randomGenerator)
         };
         
-        std::string name = "Villager_" + std::to_string(i);
-        auto npc = std::make_unique<PopulationNPC>(name, traits);
-        m_population.push_back(std::move(npc));
+        m_population.create("Villager_" + std::to_string(i), traits);
+    }
+}
+
+PopulationHandle PopulationManager::AddNPC(const std::string& name, const GeneticTraits& traits) {
+    return m_population.create(name, traits);
+}
+
+void PopulationManager::RemoveNPC(const std::string& name) {
+    for (size_t i = 0; i < m_population.size(); ++i) {
+        PopulationHandle handle = m_population.handleAt(i);
+        if (m_population.at(handle).GetName() == name) {
+            m_population.release(handle);
+            return;
+        }
     }
 }
 
 void PopulationManager::SimulatePopulationCycle(float deltaTime) {
     // Update each NPC
-    for (auto& npc : m_population) {
-        npc->ProgressAge(deltaTime);
-    }
+    ForEachNPC([deltaTime](PopulationNPC& npc) {
+        npc.ProgressAge(deltaTime);
+    });
 
     // Handle reproduction and population management
     HandleReproduction();
@@ -101,14 +114,15 @@ void PopulationManager::SimulatePopulationCycle(float deltaTime) {
 }
 
 void PopulationManager::HandleReproduction() {
+    // Pointers stay valid while children are created; only release() moves NPCs
     std::vector<PopulationNPC*> reproducibleNPCs;
     
     // Find NPCs capable of reproduction
-    for (auto& npc : m_population) {
-        if (npc->CanReproduce()) {
-            reproducibleNPCs.push_back(npc.get());
+    m_population.forEach([&reproducibleNPCs](PopulationNPC& npc) {
+        if (npc.CanReproduce()) {
+            reproducibleNPCs.push_back(&npc);
         }
-    }
+    });
 
     // Pair and reproduce
     while (reproducibleNPCs.size() >= 2) {
@@ -117,49 +131,49 @@ void PopulationManager::HandleReproduction() {
         
         auto partner2 = FindReproductivePartner(partner1);
         if (partner2) {
-            auto* child = partner1->Reproduce(partner2);
-            if (child) {
-                m_population.push_back(std::unique_ptr<PopulationNPC>(child));
-            }
+            partner1->Reproduce(partner2, m_population);
         }
     }
 }
 
 PopulationNPC* PopulationManager::FindReproductivePartner(PopulationNPC* npc) {
     // Simple partner selection based on proximity and compatibility
-    for (auto& potentialPartner : m_population) {
-        if (potentialPartner.get() != npc && 
-            potentialPartner->CanReproduce() && 
-            potentialPartner->GetRelationshipStrength(npc->GetName()) > 0.5f) {
-            return potentialPartner.get();
+    const ForgeEngine::Core::EntityId npcId = npc->GetId();
+    for (size_t p = 0; p < m_population.pageCount(); ++p) {
+        for (PopulationNPC& potentialPartner : m_population.page(p)) {
+            if (&potentialPartner != npc && 
+                potentialPartner.CanReproduce() && 
+                potentialPartner.GetRelationshipStrength(npcId) > 0.5f) {
+                return &potentialPartner;
+            }
         }
     }
     return nullptr;
 }
 
 void PopulationManager::ManagePopulationGrowth() {
-    // Remove elderly NPCs
-    m_population.erase(
-        std::remove_if(m_population.begin(), m_population.end(),
-            [](const auto& npc) { 
-                return npc->GetLifeStage() == LifeStage::Elder && 
-                       npc->GetAge() > 75.0f; 
-            }), 
-        m_population.end()
-    );
+    // Remove elderly NPCs. Walking backwards, each release() fills the hole
+    // with an NPC that has already been checked, and frees its slot for reuse.
+    for (size_t i = m_population.size(); i-- > 0;) {
+        PopulationHandle handle = m_population.handleAt(i);
+        const PopulationNPC& npc = m_population.at(handle);
+        if (npc.GetLifeStage() == LifeStage::Elder && npc.GetAge() > 75.0f) {
+            m_population.release(handle);
+        }
+    }
 }
 
 void PopulationManager::UpdateDecisionModels() {
     // Periodically update NPCs' decision-making models
-    for (auto& npc : m_population) {
+    ForEachNPC([](PopulationNPC& npc) {
         std::vector<std::pair<std::string, float>> experiences;
         // Collect recent experiences and their outcomes
         // This is a placeholder - you'd implement more sophisticated experience tracking
-        experiences.push_back({"work", npc->GetWorkMotivation()});
-        experiences.push_back({"social", npc->GetSocialNeed()});
+        experiences.push_back({"work", npc.GetWorkMotivation()});
+        experiences.push_back({"social", npc.GetSocialNeed()});
         
-        npc->TrainDecisionModel(experiences);
-    }
+        npc.TrainDecisionModel(experiences);
+    });
 }
 
 // StoryEngine Implementation
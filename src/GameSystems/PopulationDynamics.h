@@ -1,5 +1,7 @@
 #pragma once
 #include "NPCAdvanced.h"
+#include "../Core/SlabPool.h"
+#include "../Core/ThreadPool.h"
 #include <random>
 #include <functional>
 #include <map>
@@ -46,6 +48,12 @@ enum class LifeStage {
     Elder
 };
 
+class PopulationNPC;
+
+// Villagers live packed in slab pages; births and deaths recycle slots
+using PopulationPool = ForgeEngine::Core::SlabPool<PopulationNPC>;
+using PopulationHandle = ForgeEngine::Core::SlabHandle<PopulationNPC>;
+
 // Advanced NPC with Lifecycle and Learning Capabilities
 class PopulationNPC : public AdvancedNPC {
 public:
@@ -58,7 +66,8 @@ public:
 
     // Reproduction System
     bool CanReproduce() const;
-    PopulationNPC* Reproduce(PopulationNPC* partner);
+    // Creates the child in pool; an invalid handle if either parent cannot reproduce
+    PopulationHandle Reproduce(PopulationNPC* partner, PopulationPool& pool);
 
     // Skill Learning System
     void LearnSkill(const std::string& skillName, float learningRate);
@@ -86,12 +95,15 @@ private:
 // Population Management System
 class PopulationManager {
 public:
-    PopulationManager(int initialPopulation);
+    PopulationManager(int initialPopulation,
+                      std::shared_ptr<ForgeEngine::Core::ThreadPool> threadPool = nullptr);
 
     // Population Dynamics
     void SimulatePopulationCycle(float deltaTime);
-    void AddNPC(std::unique_ptr<PopulationNPC> npc);
+    PopulationHandle AddNPC(const std::string& name, const GeneticTraits& traits);
     void RemoveNPC(const std::string& name);
+    PopulationNPC* GetNPC(PopulationHandle handle) { return m_population.get(handle); }
+    size_t GetPopulationSize() const { return m_population.size(); }
 
     // Reproduction and Growth
     void HandleReproduction();
@@ -102,8 +114,25 @@ public:
     void ModelEconomicConditions();
 
 private:
-    std::vector<std::unique_ptr<PopulationNPC>> m_population;
+    PopulationPool m_population;
     std::mt19937 m_randomGenerator;
+    std::shared_ptr<ForgeEngine::Core::ThreadPool> m_threadPool;
+
+    // Applies fn to every NPC, in parallel when a thread pool is available,
+    // one slab page per task. fn must only touch the NPC it is given.
+    template<typename F>
+    void ForEachNPC(F&& fn) {
+        if (m_threadPool) {
+            m_threadPool->parallelFor(size_t{0}, m_population.pageCount(), 1,
+                [this, &fn](size_t page) {
+                    for (PopulationNPC& npc : m_population.page(page)) {
+                        fn(npc);
+                    }
+                });
+        } else {
+            m_population.forEach(fn);
+        }
+    }
 
     // Reproduction Helpers
     PopulationNPC* FindReproductivePartner(PopulationNPC* npc);
@@ -4,21 +4,25 @@
 #include <string>
 #include <memory>
 #include "../Core/Profiler.h"
+#include "../Core/Symbol.h"
 #include "CulturalConstraintsSystem.h"
 #include "EconomicSystem.h"
 
 namespace Forge {
 
 struct Skill {
-    std::string name;
+    ForgeEngine::Core::Symbol name;
     float level;          // 0.0 to 1.0
     float experience;     // Progress to next level
     float aptitude;       // Natural learning rate
-    std::vector<std::string> prerequisites;
+    std::vector<ForgeEngine::Core::Symbol> prerequisites;
 };
 
+// An NPC's skills, keyed by skill name
+using SkillSet = std::unordered_map<ForgeEngine::Core::Symbol, Skill>;
+
 struct ProfessionRequirement {
-    std::string skillName;
+    ForgeEngine::Core::Symbol skillName;
     float minimumLevel;
     bool isMandatory;
 };
@@ -26,12 +30,12 @@ struct ProfessionRequirement {
 class ProfessionDefinition {
 public:
     ProfessionDefinition(
-        const std::string& name,
+        ForgeEngine::Core::Symbol name,
         SocialClass minClass,
         const std::vector<ProfessionRequirement>& reqs
     ) : name(name), minimumSocialClass(minClass), requirements(reqs) {}
 
-    bool meetsRequirements(const std::unordered_map<std::string, Skill>& skills) const {
+    bool meetsRequirements(const SkillSet& skills) const {
         for (const auto& req : requirements) {
             auto it = skills.find(req.skillName);
             if (req.isMandatory && (it == skills.end() || it->second.level < req.minimumLevel)) {
@@ -41,12 +45,12 @@ public:
         return true;
     }
 
-    const std::string& getName() const { return name; }
+    ForgeEngine::Core::Symbol getName() const { return name; }
     SocialClass getMinimumSocialClass() const { return minimumSocialClass; }
     const std::vector<ProfessionRequirement>& getRequirements() const { return requirements; }
 
 private:
-    std::string name;
+    ForgeEngine::Core::Symbol name;
     SocialClass minimumSocialClass;
     std::vector<ProfessionRequirement> requirements;
 };
@@ -58,15 +62,14 @@ public:
     }
 
     void updateSkills(
-        std::unordered_map<std::string, Skill>& skills,
-        const std::string& activity,
+        SkillSet& skills,
+        ForgeEngine::Core::Symbol activity,
         float duration,
         float quality
     ) {
         PROFILE_SCOPE("ProfessionSystem_UpdateSkills");
 
-        auto relevantSkills = getRelevantSkills(activity);
-        for (const auto& skillName : relevantSkills) {
+        for (ForgeEngine::Core::Symbol skillName : getRelevantSkills(activity)) {
             auto it = skills.find(skillName);
             if (it != skills.end()) {
                 updateSkill(it->second, duration, quality);
@@ -75,8 +78,8 @@ public:
     }
 
     bool canProgressToProfession(
-        const std::string& professionName,
-        const std::unordered_map<std::string, Skill>& skills,
+        ForgeEngine::Core::Symbol professionName,
+        const SkillSet& skills,
         SocialClass socialClass
     ) {
         auto it = professionDefinitions.find(professionName);
@@ -88,11 +91,11 @@ public:
         return profession.meetsRequirements(skills);
     }
 
-    std::vector<std::string> getAvailableProfessions(
-        const std::unordered_map<std::string, Skill>& skills,
+    std::vector<ForgeEngine::Core::Symbol> getAvailableProfessions(
+        const SkillSet& skills,
         SocialClass socialClass
     ) {
-        std::vector<std::string> available;
+        std::vector<ForgeEngine::Core::Symbol> available;
         for (const auto& [name, profession] : professionDefinitions) {
             if (canProgressToProfession(name, skills, socialClass)) {
                 available.push_back(name);
@@ -102,8 +105,8 @@ public:
     }
 
     float calculateProfessionEfficiency(
-        const std::string& professionName,
-        const std::unordered_map<std::string, Skill>& skills
+        ForgeEngine::Core::Symbol professionName,
+        const SkillSet& skills
     ) {
         auto it = professionDefinitions.find(professionName);
         if (it == professionDefinitions.end()) return 0.0f;
@@ -120,45 +123,47 @@ public:
     }
 
 private:
-    std::unordered_map<std::string, ProfessionDefinition> professionDefinitions;
+    std::unordered_map<ForgeEngine::Core::Symbol, ProfessionDefinition> professionDefinitions;
 
     void initializeProfessions() {
+        using ForgeEngine::Core::Symbol;
+
         // Initialize medieval professions with historical accuracy
         professionDefinitions.emplace(
-            "Blacksmith",
+            Symbol("Blacksmith"),
             ProfessionDefinition(
-                "Blacksmith",
+                Symbol("Blacksmith"),
                 SocialClass::Merchant,
                 {
-                    {"Metalworking", 0.5f, true},
-                    {"Physical_Strength", 0.3f, true},
-                    {"Tool_Knowledge", 0.4f, true}
+                    {Symbol("Metalworking"), 0.5f, true},
+                    {Symbol("Physical_Strength"), 0.3f, true},
+                    {Symbol("Tool_Knowledge"), 0.4f, true}
                 }
             )
         );
 
         professionDefinitions.emplace(
-            "Merchant",
+            Symbol("Merchant"),
             ProfessionDefinition(
-                "Merchant",
+                Symbol("Merchant"),
                 SocialClass::Merchant,
                 {
-                    {"Negotiation", 0.6f, true},
-                    {"Mathematics", 0.4f, true},
-                    {"Language", 0.3f, true}
+                    {Symbol("Negotiation"), 0.6f, true},
+                    {Symbol("Mathematics"), 0.4f, true},
+                    {Symbol("Language"), 0.3f, true}
                 }
             )
         );
 
         professionDefinitions.emplace(
-            "Scribe",
+            Symbol("Scribe"),
             ProfessionDefinition(
-                "Scribe",
+                Symbol("Scribe"),
                 SocialClass::Clergy,
                 {
-                    {"Writing", 0.7f, true},
-                    {"Reading", 0.7f, true},
-                    {"Latin", 0.5f, true}
+                    {Symbol("Writing"), 0.7f, true},
+                    {Symbol("Reading"), 0.7f, true},
+                    {Symbol("Latin"), 0.5f, true}
                 }
             )
         );
@@ -166,17 +171,20 @@ private:
         // Add more historical professions
     }
 
-    std::vector<std::string> getRelevantSkills(const std::string& activity) {
+    const std::vector<ForgeEngine::Core::Symbol>& getRelevantSkills(ForgeEngine::Core::Symbol activity) {
+        using ForgeEngine::Core::Symbol;
+
         // Map activities to relevant skills
-        static const std::unordered_map<std::string, std::vector<std::string>> activitySkillMap = {
-            {"Forge_Item", {"Metalworking", "Tool_Knowledge"}},
-            {"Trade_Goods", {"Negotiation", "Mathematics"}},
-            {"Write_Document", {"Writing", "Reading", "Latin"}}
+        static const std::unordered_map<Symbol, std::vector<Symbol>> activitySkillMap = {
+            {Symbol("Forge_Item"), {Symbol("Metalworking"), Symbol("Tool_Knowledge")}},
+            {Symbol("Trade_Goods"), {Symbol("Negotiation"), Symbol("Mathematics")}},
+            {Symbol("Write_Document"), {Symbol("Writing"), Symbol("Reading"), Symbol("Latin")}}
             // Add more mappings
         };
+        static const std::vector<Symbol> noSkills;
 
         auto it = activitySkillMap.find(activity);
-        return it != activitySkillMap.end() ? it->second : std::vector<std::string>();
+        return it != activitySkillMap.end() ? it->second : noSkills;
     }
 
     void updateSkill(Skill& skill, float duration, float quality) {
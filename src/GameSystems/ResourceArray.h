@@ -0,0 +1,126 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace Forge {
+
+// Economic Resource Types
+enum class ResourceType {
+    Food,
+    Wood,
+    Stone,
+    Metal,
+    Cloth,
+    Tools
+};
+
+inline constexpr size_t ResourceTypeCount = 6;
+
+inline constexpr std::array<ResourceType, ResourceTypeCount> AllResourceTypes = {
+    ResourceType::Food, ResourceType::Wood, ResourceType::Stone,
+    ResourceType::Metal, ResourceType::Cloth, ResourceType::Tools
+};
+
+// One value per ResourceType, indexed directly by the enum. Arithmetic
+// arrays are padded to eight lanes and 32-byte aligned, so whole-array math
+// compiles to one AVX or two SSE instructions per operation. The padding
+// lanes start at zero and every operator keeps them there.
+template<typename T>
+class ResourceArray {
+public:
+    static constexpr size_t Lanes = std::is_arithmetic_v<T> ? 8 : ResourceTypeCount;
+
+    constexpr ResourceArray() = default;
+
+    // Unlisted resources are value-initialized
+    constexpr ResourceArray(std::initializer_list<std::pair<ResourceType, T>> entries) {
+        for (const auto& [type, value] : entries) {
+            (*this)[type] = value;
+        }
+    }
+
+    constexpr T& operator[](ResourceType type) { return m_values[static_cast<size_t>(type)]; }
+    constexpr const T& operator[](ResourceType type) const { return m_values[static_cast<size_t>(type)]; }
+
+    // Calls fn(type, value) for every resource, in enum order
+    template<typename F>
+    constexpr void forEach(F&& fn) {
+        for (ResourceType type : AllResourceTypes) {
+            fn(type, (*this)[type]);
+        }
+    }
+
+    template<typename F>
+    constexpr void forEach(F&& fn) const {
+        for (ResourceType type : AllResourceTypes) {
+            fn(type, (*this)[type]);
+        }
+    }
+
+    ResourceArray& operator+=(const ResourceArray& other) requires std::is_arithmetic_v<T> {
+        for (size_t i = 0; i < Lanes; ++i) m_values[i] += other.m_values[i];
+        return *this;
+    }
+
+    ResourceArray& operator-=(const ResourceArray& other) requires std::is_arithmetic_v<T> {
+        for (size_t i = 0; i < Lanes; ++i) m_values[i] -= other.m_values[i];
+        return *this;
+    }
+
+    ResourceArray& operator*=(const ResourceArray& other) requires std::is_arithmetic_v<T> {
+        for (size_t i = 0; i < Lanes; ++i) m_values[i] *= other.m_values[i];
+        return *this;
+    }
+
+    ResourceArray& operator*=(T scale) requires std::is_arithmetic_v<T> {
+        for (size_t i = 0; i < Lanes; ++i) m_values[i] *= scale;
+        return *this;
+    }
+
+    friend ResourceArray operator+(const ResourceArray& a, const ResourceArray& b) requires std::is_arithmetic_v<T> {
+        ResourceArray result = a;
+        return result += b;
+    }
+
+    friend ResourceArray operator-(const ResourceArray& a, const ResourceArray& b) requires std::is_arithmetic_v<T> {
+        ResourceArray result = a;
+        return result -= b;
+    }
+
+    friend ResourceArray operator*(const ResourceArray& a, const ResourceArray& b) requires std::is_arithmetic_v<T> {
+        ResourceArray result = a;
+        return result *= b;
+    }
+
+    friend ResourceArray operator*(const ResourceArray& a, T scale) requires std::is_arithmetic_v<T> {
+        ResourceArray result = a;
+        return result *= scale;
+    }
+
+    // Raises negative quantities to zero
+    ResourceArray& clampNonNegative() requires std::is_arithmetic_v<T> {
+        for (size_t i = 0; i < Lanes; ++i) m_values[i] = std::max(m_values[i], T{});
+        return *this;
+    }
+
+    // Summed pairwise in a fixed order, so the result does not depend on
+    // whether the compiler vectorized the loop
+    T sum() const requires std::is_arithmetic_v<T> {
+        return ((m_values[0] + m_values[4]) + (m_values[1] + m_values[5])) +
+               ((m_values[2] + m_values[6]) + (m_values[3] + m_values[7]));
+    }
+
+    // Total value of quantities priced per unit by weights
+    friend T dot(const ResourceArray& quantities, const ResourceArray& weights) requires std::is_arithmetic_v<T> {
+        return (quantities * weights).sum();
+    }
+
+private:
+    alignas(std::is_arithmetic_v<T> ? 32 : alignof(T)) T m_values[Lanes]{};
+};
+
+} // namespace Forge
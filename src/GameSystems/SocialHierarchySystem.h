@@ -2,6 +2,7 @@
 #include "CulturalConstraintsSystem.h"
 #include "EconomicSystem.h"
 #include "../AI/PersonalitySystem.h"
+#include "../Core/EntityRegistry.h"
 #include <unordered_map>
 #include <set>
 #include <memory>
@@ -35,8 +36,8 @@ public:
         }
 
         // Update based on cultural factors
-        std::vector<std::string> culturalEvents = m_culturalSystem->GenerateCulturalEvents(npc);
-        for (const auto& event : culturalEvents) {
+        std::vector<ForgeEngine::Core::Symbol> culturalEvents = m_culturalSystem->GenerateCulturalEvents(npc);
+        for (ForgeEngine::Core::Symbol event : culturalEvents) {
             ApplyCulturalEventImpact(status, event);
         }
 
@@ -68,30 +69,22 @@ public:
 
     // Influence Calculation
     float CalculateInfluence(PopulationNPC* npc) const {
-        auto it = m_socialStatuses.find(npc->GetID());
-        if (it != m_socialStatuses.end()) {
-            return it->second.influence;
-        }
-        return 0.0f;
+        auto it = m_socialStatuses.find(npc->GetId());
+        return it != m_socialStatuses.end() ? it->second.influence : 0.0f;
     }
 
 private:
     std::shared_ptr<CulturalConstraintsSystem> m_culturalSystem;
     std::shared_ptr<EconomicSystem> m_economicSystem;
-    std::unordered_map<int, SocialStatus> m_socialStatuses;  // NPC ID to status mapping
+    std::unordered_map<ForgeEngine::Core::EntityId, SocialStatus> m_socialStatuses;  // NPC ID to status mapping
 
     SocialStatus& GetOrCreateStatus(PopulationNPC* npc) {
-        auto it = m_socialStatuses.find(npc->GetID());
-        if (it == m_socialStatuses.end()) {
-            SocialStatus newStatus{
-                SocialClass::Peasant,  // Default class
-                0.0f,                  // Initial prestige
-                0.0f,                  // Initial influence
-                0.0f                   // Initial reputation
-            };
-            auto [inserted_it, success] = m_socialStatuses.insert({npc->GetID(), newStatus});
-            return inserted_it->second;
-        }
+        auto it = m_socialStatuses.try_emplace(npc->GetId(), SocialStatus{
+            SocialClass::Peasant,  // Default class
+            0.0f,                  // Initial prestige
+            0.0f,                  // Initial influence
+            0.0f                   // Initial reputation
+        }).first;
         return it->second;
     }
 
@@ -100,11 +93,14 @@ private:
         return std::min(1.0f, 0.2f * std::log(1.0f + wealth));
     }
 
-    void ApplyCulturalEventImpact(SocialStatus& status, const std::string& event) {
+    void ApplyCulturalEventImpact(SocialStatus& status, ForgeEngine::Core::Symbol event) {
+        static const ForgeEngine::Core::Symbol marriageHigherClass("Marriage_HigherClass");
+        static const ForgeEngine::Core::Symbol criminalActivity("Criminal_Activity");
+
         // Example event impacts
-        if (event == "Marriage_HigherClass") {
+        if (event == marriageHigherClass) {
             status.prestige += 0.15f;
-        } else if (event == "Criminal_Activity") {
+        } else if (event == criminalActivity) {
             status.reputation -= 0.2f;
         }
         // Clamp values
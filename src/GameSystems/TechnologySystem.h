@@ -3,21 +3,23 @@
 #include <memory>
 #include <unordered_map>
 #include <string>
+#include "../Core/Symbol.h"
 #include "../Core/ThreadPool.h"
+#include "../Core/TaskGroup.h"
 #include "EconomicSystem.h"
 #include "ProfessionSystem.h"
 
 namespace Forge {
 
 struct Technology {
-    std::string name;
+    ForgeEngine::Core::Symbol name;
     std::string description;
     float progressPoints;      // Current progress towards discovery
     float requiredPoints;      // Points needed for discovery
     bool discovered;
-    std::vector<std::string> prerequisites;
-    std::unordered_map<ResourceType, float> resourceRequirements;
-    std::vector<std::string> enabledProfessions;
+    std::vector<ForgeEngine::Core::Symbol> prerequisites;
+    ResourceArray<float> resourceRequirements;  // zero where none is needed
+    std::vector<ForgeEngine::Core::Symbol> enabledProfessions;
     float productivityBonus;   // Bonus to related activities
 };
 
@@ -39,6 +41,7 @@ public:
 
     void updateTechnology(float deltaTime) {
         PROFILE_SCOPE("TechnologySystem_Update");
+        ForgeEngine::Core::TaskGroup frameTasks(*m_threadPool);
 
         // Update research projects
         for (auto& project : activeProjects) {
@@ -49,10 +52,13 @@ public:
         checkBreakthroughs();
 
         // Update technology diffusion
-        updateTechnologyDiffusion(deltaTime);
+        updateTechnologyDiffusion(frameTasks, deltaTime);
+
+        // Diffusion reads the technology tree that the next update writes
+        frameTasks.wait();
     }
 
-    bool startResearch(const std::string& techName) {
+    bool startResearch(ForgeEngine::Core::Symbol techName) {
         auto tech = findTechnology(techName);
         if (!tech || tech->discovered) return false;
 
@@ -70,7 +76,7 @@ public:
         return true;
     }
 
-    float getTechnologyLevel(const std::string& techName) const {
+    float getTechnologyLevel(ForgeEngine::Core::Symbol techName) const {
         auto tech = findTechnology(techName);
         if (!tech) return 0.0f;
         return tech->discovered ? 1.0f : (tech->progressPoints / tech->requiredPoints);
@@ -94,52 +100,61 @@ private:
     
     void initializeTechnologyTree() {
         // Medieval Technologies
+        using ForgeEngine::Core::Symbol;
+
         technologies.push_back({
-            "Three-Field Rotation",
+            Symbol("Three-Field Rotation"),
             "Advanced farming technique that improves crop yield",
             0.0f, 100.0f, false,
             {},  // No prerequisites
             {{ResourceType::Food, 50.0f}},
-            {"Farmer"},
+            {Symbol("Farmer")},
             0.2f
         });
 
         technologies.push_back({
-            "Water Mill",
+            Symbol("Water Mill"),
             "Mechanical power from water flow",
             0.0f, 150.0f, false,
             {},
             {{ResourceType::Wood, 100.0f}, {ResourceType::Stone, 50.0f}},
-            {"Miller"},
+            {Symbol("Miller")},
             0.3f
         });
 
         technologies.push_back({
-            "Steel Forging",
+            Symbol("Steel Forging"),
             "Advanced metalworking techniques",
             0.0f, 200.0f, false,
-            {"Basic Metallurgy"},
+            {Symbol("Basic Metallurgy")},
             {{ResourceType::Metal, 100.0f}, {ResourceType::Tools, 50.0f}},
-            {"Blacksmith"},
+            {Symbol("Blacksmith")},
             0.4f
         });
 
         // Add more medieval technologies
     }
 
-    Technology* findTechnology(const std::string& name) {
+    Technology* findTechnology(ForgeEngine::Core::Symbol name) {
         for (auto& tech : technologies) {
             if (tech.name == name) return &tech;
         }
         return nullptr;
     }
 
+    const Technology* findTechnology(ForgeEngine::Core::Symbol name) const {
+        for (const auto& tech : technologies) {
+            if (tech.name == name) return &tech;
+        }
+        return nullptr;
+    }
+
     bool arePrerequisitesMet(const Technology& tech) const {
         for (const auto& prereq : tech.prerequisites) {
             auto prereqTech = std::find_if(
                 technologies.begin(),
                 technologies.end(),
-                [&prereq](const Technology& t) { return t.name == prereq; }
+                [prereq](const Technology& t) { return t.name == prereq; }
             );
             if (prereqTech == technologies.end() || !prereqTech->discovered) {
                 return false;
@@ -153,12 +168,13 @@ private:
         float progress = project.progressRate * deltaTime;
         
         // Apply modifiers based on available resources
-        for (const auto& [resource, amount] : project.targetTechnology->resourceRequirements) {
+        project.targetTechnology->resourceRequirements.forEach([&](ResourceType resource, float amount) {
+            if (amount <= 0.0f) return;
             float available = m_economicSystem->getResourceQuantity(resource);
             if (available < amount) {
                 progress *= (available / amount);
             }
-        }
+        });
 
         project.targetTechnology->progressPoints += progress;
     }
@@ -172,18 +188,18 @@ private:
         }
     }
 
-    void updateTechnologyDiffusion(float deltaTime) {
+    void updateTechnologyDiffusion(ForgeEngine::Core::TaskGroup& tasks, float deltaTime) {
         // Simulate technology spreading between regions and villages
-        m_threadPool->enqueue([this, deltaTime]() {
-            PROFILE_SCOPE("TechnologySystem_Diffusion");
-            
-            for (auto& tech : technologies) {
-                if (tech.discovered) {
+        for (const auto& tech : technologies) {
+            if (tech.discovered) {
+                tasks.run([this, &tech]() {
+                    PROFILE_SCOPE("TechnologySystem_Diffusion");
+
                     // Simulate knowledge sharing between regions
                     spreadKnowledge(tech);
-                }
+                });
             }
-        });
+        }
     }
 
     float calculateBaseProgressRate(Technology* tech) {
@@ -195,10 +211,11 @@ private:
         
         // Adjust for available resources
         float resourceModifier = 1.0f;
-        for (const auto& [resource, amount] : tech->resourceRequirements) {
+        tech->resourceRequirements.forEach([&](ResourceType resource, float amount) {
+            if (amount <= 0.0f) return;
             float available = m_economicSystem->getResourceQuantity(resource);
             resourceModifier *= std::min(1.0f, available / amount);
-        }
+        });
         
         return baseRate * resourceModifier;
     }
@@ -27,11 +27,37 @@ void WorldGenerator::GenerateWorld() {
     PopulateBiomes();
 }
 
+ForgeEngine::Core::Task<void> WorldGenerator::GenerateWorldAsync(ForgeEngine::Core::CoroutineScheduler& scheduler) {
+    co_await scheduler.schedule();
+    m_terrain.resize(m_worldSizeX * m_worldSizeZ);
+
+    // Tiles only depend on their own coordinates, so bands of rows can be
+    // generated independently
+    const int bandSize = 16;
+    std::vector<ForgeEngine::Core::Task<void>> bands;
+    for (int z = 0; z < m_worldSizeZ; z += bandSize) {
+        bands.push_back(GenerateTerrainRowsAsync(z, std::min(z + bandSize, m_worldSizeZ)));
+    }
+    co_await scheduler.whenAll(std::move(bands));
+
+    // Building placement samples the finished terrain
+    GenerateBuildings();
+    PopulateBiomes();
+}
+
 void WorldGenerator::GenerateTerrain() {
     m_terrain.resize(m_worldSizeX * m_worldSizeZ);
+    GenerateTerrainRows(0, m_worldSizeZ);
+}
+
+ForgeEngine::Core::Task<void> WorldGenerator::GenerateTerrainRowsAsync(int zBegin, int zEnd) {
+    GenerateTerrainRows(zBegin, zEnd);
+    co_return;
+}
 
-    for (int x = 0; x < m_worldSizeX; ++x) {
-        for (int z = 0; z < m_worldSizeZ; ++z) {
+void WorldGenerator::GenerateTerrainRows(int zBegin, int zEnd) {
+    for (int z = zBegin; z < zEnd; ++z) {
+        for (int x = 0; x < m_worldSizeX; ++x) {
             int index = x + z * m_worldSizeX;
             
             // Generate height using Perlin noise
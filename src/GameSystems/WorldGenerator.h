@@ -3,6 +3,7 @@
 #include <memory>
 #include <DirectXMath.h>
 #include <random>
+#include "../Core/CoroutineScheduler.h"
 
 namespace Forge {
     // Terrain Types
@@ -57,6 +58,9 @@ namespace Forge {
         WorldGenerator(int worldSizeX, int worldSizeZ);
 
         void GenerateWorld();
+        // Same as GenerateWorld(), but terrain bands are generated in parallel
+        // on the thread pool and the caller's frame is never blocked
+        ForgeEngine::Core::Task<void> GenerateWorldAsync(ForgeEngine::Core::CoroutineScheduler& scheduler);
         void GenerateTerrain();
         void GenerateBuildings();
         void PopulateBiomes();
@@ -71,6 +75,10 @@ namespace Forge {
         std::vector<Building> m_buildings;
         std::vector<BiomeData> m_biomes;
 
+        // Fills the terrain tiles of rows [zBegin, zEnd); m_terrain must be sized
+        void GenerateTerrainRows(int zBegin, int zEnd);
+        ForgeEngine::Core::Task<void> GenerateTerrainRowsAsync(int zBegin, int zEnd);
+
         // Noise generation for terrain
         float GeneratePerlinNoise(float x, float y, int octaves);
         
@@ -100,7 +100,7 @@ TEST_CASE("StorytellingSystem Technology Integration", "[StorytellingSystem]") {
 
     SECTION("Technology Discovery Event") {
         // Simulate technology discovery
-        env.techSystem->startResearch("WaterMill");
+        env.techSystem->startResearch(ForgeEngine::Core::Symbol("WaterMill"));
         
         // Fast forward research
         for(int i = 0; i < 10; i++) {
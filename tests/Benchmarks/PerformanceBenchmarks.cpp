@@ -1,17 +1,696 @@
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../../src/Core/BehaviorTree.h"
+#include "../../src/Core/ECS.h"
+#include "../../src/Core/IdMap.h"
 #include "../../src/Core/ObjectPool.h"
+#include "../../src/Core/SlabPool.h"
+#include "../../src/Core/Symbol.h"
+#include "../../src/Core/ThreadPool.h"
+#include "../../src/GameSystems/EconomicSystem.h"
 #include "../../src/GameSystems/MultiVillageSystem.h"
+#include "../../src/GameSystems/NPCAdvanced.h"
+#include "../../src/GameSystems/NPCNeeds.h"
+#include "../../src/GameSystems/PopulationDynamics.h"
+#include "../../src/GameSystems/ResourceArray.h"
 #include "../../src/AI/StorytellingSystem.h"
 
+// Allocation counting: replaces global operator new for this binary so
+// benchmarks can report heap allocations per operation.
+static std::atomic<size_t> g_totalAllocations{0};
+static thread_local size_t t_threadAllocations = 0;
+static thread_local size_t t_threadAllocatedBytes = 0;
+
+// GCC cannot see that these replacements pair malloc with free
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    g_totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    ++t_threadAllocations;
+    t_threadAllocatedBytes += size;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
 // Memory Management Benchmarks
+// One pool shared by every benchmark thread, as the parallel NPC updates
+// would share it
 static void BM_ObjectPoolAllocation(benchmark::State& state) {
-    ForgeEngine::Core::ObjectPool<int> pool(1000);
+    static ForgeEngine::Core::ObjectPool<int> pool(1000);
     for (auto _ : state) {
         auto* obj = pool.acquire();
+        benchmark::DoNotOptimize(obj);
         pool.release(obj);
     }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ObjectPoolAllocation)->ThreadRange(1, 64)->UseRealTime();
+
+// Bursts larger than a magazine, so threads keep trading with the depot
+static void BM_ObjectPoolBurst(benchmark::State& state) {
+    static ForgeEngine::Core::ObjectPool<int> pool(1000);
+    std::vector<int*> held(100);
+    for (auto _ : state) {
+        for (auto& obj : held) {
+            obj = pool.acquire();
+        }
+        for (auto* obj : held) {
+            pool.release(obj);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(held.size()));
+}
+BENCHMARK(BM_ObjectPoolBurst)->ThreadRange(1, 64)->UseRealTime();
+
+// One pass over NPC-sized records: packed in SlabPool pages versus one heap
+// block each, visited in an order unrelated to their addresses
+struct BenchmarkAgent {
+    float hunger = 0.0f;
+    float energy = 1.0f;
+    float position[2] = {0.0f, 0.0f};
+    char payload[48] = {};
+};
+
+static void BM_SlabPoolIteration(benchmark::State& state) {
+    ForgeEngine::Core::SlabPool<BenchmarkAgent> agents;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        agents.create();
+    }
+    for (auto _ : state) {
+        agents.forEach([](BenchmarkAgent& agent) {
+            agent.hunger += 0.01f;
+            agent.energy -= 0.01f;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SlabPoolIteration)->Arg(100000);
+
+static void BM_HeapObjectIteration(benchmark::State& state) {
+    std::vector<std::unique_ptr<BenchmarkAgent>> agents;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        agents.push_back(std::make_unique<BenchmarkAgent>());
+    }
+    std::shuffle(agents.begin(), agents.end(), std::mt19937(42));
+    for (auto _ : state) {
+        for (auto& agent : agents) {
+            agent->hunger += 0.01f;
+            agent->energy -= 0.01f;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HeapObjectIteration)->Arg(100000);
+
+// One pass over two components of 100k entities: an ECS query over packed
+// columns versus NPC objects reached through a name-keyed map
+static void BM_ECSQueryIteration(benchmark::State& state) {
+    ForgeEngine::Core::World world;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        world.create(BenchmarkAgent{}, static_cast<int>(i), std::string("npc") + std::to_string(i));
+    }
+    auto& agents = world.query<BenchmarkAgent, const int>();
+    for (auto _ : state) {
+        agents.forEach([](BenchmarkAgent& agent, const int& id) {
+            agent.hunger += 0.01f * static_cast<float>(id & 1);
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ECSQueryIteration)->Arg(100000);
+
+static void BM_NameMapIteration(benchmark::State& state) {
+    struct MappedAgent {
+        BenchmarkAgent agent;
+        int id;
+    };
+    std::unordered_map<std::string, std::unique_ptr<MappedAgent>> agents;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        agents[std::string("npc") + std::to_string(i)] =
+            std::make_unique<MappedAgent>(MappedAgent{BenchmarkAgent{}, static_cast<int>(i)});
+    }
+    for (auto _ : state) {
+        for (auto& [name, mapped] : agents) {
+            mapped->agent.hunger += 0.01f * static_cast<float>(mapped->id & 1);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NameMapIteration)->Arg(100000);
+
+// Relationship lookups across a 50k-NPC village cluster, each NPC knowing
+// 32 others: keyed by name in node-based maps versus by ID in IdMaps.
+// bytes_per_relationship counts the heap bytes the maps hold; they are
+// reserved up front so rehash garbage is not counted.
+constexpr int RelationshipNPCs = 50000;
+constexpr int RelationshipsPerNPC = 32;
+
+static void BM_RelationshipLookupByName(benchmark::State& state) {
+    std::vector<std::string> names;
+    for (int i = 0; i < RelationshipNPCs; ++i) {
+        names.push_back("Villager_" + std::to_string(i));
+    }
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, RelationshipNPCs - 1);
+
+    std::vector<std::unordered_map<std::string, float>> relationships(RelationshipNPCs);
+    const size_t bytesBefore = t_threadAllocatedBytes;
+    for (auto& known : relationships) {
+        known.reserve(RelationshipsPerNPC);
+        for (int r = 0; r < RelationshipsPerNPC; ++r) {
+            known[names[pick(rng)]] = 0.5f;
+        }
+    }
+    const size_t bytes = t_threadAllocatedBytes - bytesBefore;
+
+    for (auto _ : state) {
+        const int npc = pick(rng);
+        // What FindReproductivePartner did per candidate: copy the name, hash it
+        std::string other = names[pick(rng)];
+        auto it = relationships[npc].find(other);
+        benchmark::DoNotOptimize(it != relationships[npc].end() ? it->second : 0.0f);
+    }
+    state.counters["bytes_per_relationship"] =
+        static_cast<double>(bytes) / (RelationshipNPCs * RelationshipsPerNPC);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RelationshipLookupByName);
+
+static void BM_RelationshipLookupById(benchmark::State& state) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<uint32_t> pick(0, RelationshipNPCs - 1);
+
+    std::vector<ForgeEngine::Core::IdMap<float>> relationships(RelationshipNPCs);
+    const size_t bytesBefore = t_threadAllocatedBytes;
+    for (auto& known : relationships) {
+        known.reserve(RelationshipsPerNPC);
+        for (int r = 0; r < RelationshipsPerNPC; ++r) {
+            known[pick(rng)] = 0.5f;
+        }
+    }
+    const size_t bytes = t_threadAllocatedBytes - bytesBefore;
+
+    for (auto _ : state) {
+        const uint32_t npc = pick(rng);
+        const float* strength = relationships[npc].find(pick(rng));
+        benchmark::DoNotOptimize(strength ? *strength : 0.0f);
+    }
+    state.counters["bytes_per_relationship"] =
+        static_cast<double>(bytes) / (RelationshipNPCs * RelationshipsPerNPC);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RelationshipLookupById);
+
+// One resource tick for 1000 villages: production, clamp and valuation,
+// over hash maps keyed by ResourceType versus enum-indexed ResourceArrays
+constexpr int ResourceVillages = 1000;
+
+static void BM_VillageResourcesMap(benchmark::State& state) {
+    const std::unordered_map<Forge::ResourceType, float> values = {
+        {Forge::ResourceType::Food, 1.0f}, {Forge::ResourceType::Wood, 2.0f},
+        {Forge::ResourceType::Stone, 3.0f}, {Forge::ResourceType::Metal, 5.0f},
+        {Forge::ResourceType::Cloth, 1.0f}, {Forge::ResourceType::Tools, 8.0f}
+    };
+    std::vector<std::unordered_map<Forge::ResourceType, float>> villages(ResourceVillages);
+    for (auto& resources : villages) {
+        for (Forge::ResourceType type : Forge::AllResourceTypes) {
+            resources[type] = 100.0f;
+        }
+    }
+    for (auto _ : state) {
+        float total = 0.0f;
+        for (auto& resources : villages) {
+            for (auto& [type, quantity] : resources) {
+                quantity = std::max(0.0f, quantity + 0.5f * 0.016f);
+                total += quantity * values.at(type);
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * ResourceVillages);
+}
+BENCHMARK(BM_VillageResourcesMap);
+
+static void BM_VillageResourcesArray(benchmark::State& state) {
+    static constexpr Forge::ResourceArray<float> values{
+        {Forge::ResourceType::Food, 1.0f}, {Forge::ResourceType::Wood, 2.0f},
+        {Forge::ResourceType::Stone, 3.0f}, {Forge::ResourceType::Metal, 5.0f},
+        {Forge::ResourceType::Cloth, 1.0f}, {Forge::ResourceType::Tools, 8.0f}
+    };
+    Forge::ResourceArray<float> netChange;
+    netChange.forEach([](Forge::ResourceType, float& change) { change = 0.5f; });
+    std::vector<Forge::ResourceArray<float>> villages(ResourceVillages);
+    for (auto& resources : villages) {
+        resources.forEach([](Forge::ResourceType, float& quantity) { quantity = 100.0f; });
+    }
+    for (auto _ : state) {
+        float total = 0.0f;
+        for (auto& resources : villages) {
+            resources += netChange * 0.016f;
+            resources.clampNonNegative();
+            total += dot(resources, values);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * ResourceVillages);
+}
+BENCHMARK(BM_VillageResourcesArray);
+
+// spreadTechnology's membership test: is a technology in a village's list
+// of 24, with names compared as strings versus as interned symbols
+constexpr int KnownTechnologies = 24;
+
+static std::string technologyName(int i) {
+    return "Medieval_Technology_" + std::to_string(i);
+}
+
+static void BM_TechnologyFindString(benchmark::State& state) {
+    std::vector<std::string> known;
+    for (int i = 0; i < KnownTechnologies; ++i) {
+        known.push_back(technologyName(i));
+    }
+    const std::string missing = technologyName(KnownTechnologies);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(known.begin(), known.end(), missing));
+    }
+}
+BENCHMARK(BM_TechnologyFindString);
+
+static void BM_TechnologyFindSymbol(benchmark::State& state) {
+    std::vector<ForgeEngine::Core::Symbol> known;
+    for (int i = 0; i < KnownTechnologies; ++i) {
+        known.emplace_back(technologyName(i));
+    }
+    const ForgeEngine::Core::Symbol missing(technologyName(KnownTechnologies));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(known.begin(), known.end(), missing));
+    }
+}
+BENCHMARK(BM_TechnologyFindSymbol);
+
+// One AI tick for 100k NPCs: pick a state from the NPC's needs and run that
+// state's behavior tree. Shared trees are built once and keep per-NPC
+// progress in a BehaviorBlackboard component; the old path built a
+// sequence, an action and a std::function per NPC per tick.
+enum class BenchmarkState { Eating, Resting, Wandering, Count };
+
+static BenchmarkState chooseState(const BenchmarkAgent& agent) {
+    if (agent.hunger > 0.7f) return BenchmarkState::Eating;
+    if (agent.energy < 0.3f) return BenchmarkState::Resting;
+    return BenchmarkState::Wandering;
+}
+
+static void eat(BenchmarkAgent& agent) { agent.hunger = 0.0f; }
+static void rest(BenchmarkAgent& agent) { agent.energy = std::min(1.0f, agent.energy + 0.1f); }
+static void wander(BenchmarkAgent& agent) {
+    agent.position[0] += 0.5f;
+    agent.hunger += 0.05f;
+    agent.energy -= 0.03f;
+}
+
+static void BM_BehaviorTreeShared(benchmark::State& state) {
+    using namespace ForgeEngine::Core;
+    using Tree = BehaviorTree<BenchmarkAgent>;
+    auto makeTree = [](ActionNode<BenchmarkAgent>::Function action) {
+        auto root = std::make_unique<SequenceNode<BenchmarkAgent>>();
+        root->add(std::make_unique<ActionNode<BenchmarkAgent>>(action));
+        return std::make_unique<const Tree>(std::move(root));
+    };
+    const std::unique_ptr<const Tree> trees[] = {
+        makeTree([](BenchmarkAgent& a, BehaviorBlackboard&) { eat(a); return BehaviorStatus::Success; }),
+        makeTree([](BenchmarkAgent& a, BehaviorBlackboard&) { rest(a); return BehaviorStatus::Success; }),
+        makeTree([](BenchmarkAgent& a, BehaviorBlackboard&) { wander(a); return BehaviorStatus::Success; }),
+    };
+    static_assert(std::size(trees) == static_cast<size_t>(BenchmarkState::Count));
+
+    World world;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        world.create(BenchmarkAgent{}, BehaviorBlackboard{});
+    }
+    auto& npcs = world.query<BenchmarkAgent, BehaviorBlackboard>();
+    auto tick = [&]() {
+        npcs.forEach([&trees](BenchmarkAgent& agent, BehaviorBlackboard& blackboard) {
+            trees[static_cast<size_t>(chooseState(agent))]->execute(agent, blackboard);
+        });
+    };
+    tick();
+
+    size_t allocations = 0;
+    for (auto _ : state) {
+        const size_t before = t_threadAllocations;
+        tick();
+        allocations += t_threadAllocations - before;
+        benchmark::ClobberMemory();
+    }
+    const double updates = static_cast<double>(state.iterations()) * state.range(0);
+    state.counters["allocs_per_npc"] = allocations / updates;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BehaviorTreeShared)->Arg(100000);
+
+struct PerTickNode {
+    virtual ~PerTickNode() = default;
+    virtual bool Execute(BenchmarkAgent* agent) = 0;
+};
+
+struct PerTickAction : PerTickNode {
+    explicit PerTickAction(std::function<bool(BenchmarkAgent*)> action) : action(std::move(action)) {}
+    bool Execute(BenchmarkAgent* agent) override { return action(agent); }
+    std::function<bool(BenchmarkAgent*)> action;
+};
+
+struct PerTickSequence : PerTickNode {
+    bool Execute(BenchmarkAgent* agent) override {
+        for (auto& child : children) {
+            if (!child->Execute(agent)) return false;
+        }
+        return true;
+    }
+    std::vector<std::unique_ptr<PerTickNode>> children;
+};
+
+static void BM_BehaviorTreePerTick(benchmark::State& state) {
+    using ForgeEngine::Core::World;
+    World world;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        world.create(BenchmarkAgent{});
+    }
+    auto& npcs = world.query<BenchmarkAgent>();
+    auto tick = [&]() {
+        npcs.forEach([](BenchmarkAgent& agent) {
+            auto root = std::make_unique<PerTickSequence>();
+            switch (chooseState(agent)) {
+                case BenchmarkState::Eating:
+                    root->children.push_back(std::make_unique<PerTickAction>(
+                        [](BenchmarkAgent* a) { eat(*a); return true; }));
+                    break;
+                case BenchmarkState::Resting:
+                    root->children.push_back(std::make_unique<PerTickAction>(
+                        [](BenchmarkAgent* a) { rest(*a); return true; }));
+                    break;
+                default:
+                    root->children.push_back(std::make_unique<PerTickAction>(
+                        [](BenchmarkAgent* a) { wander(*a); return true; }));
+                    break;
+            }
+            root->Execute(&agent);
+        });
+    };
+    tick();
+
+    size_t allocations = 0;
+    for (auto _ : state) {
+        const size_t before = t_threadAllocations;
+        tick();
+        allocations += t_threadAllocations - before;
+        benchmark::ClobberMemory();
+    }
+    const double updates = static_cast<double>(state.iterations()) * state.range(0);
+    state.counters["allocs_per_npc"] = allocations / updates;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BehaviorTreePerTick)->Arg(100000);
+
+// NPCManager::Update over real AdvancedNPCs: the AI query, shared trees,
+// memory recording and emotional decay. Warmed up past NPCMemory::Capacity
+// ticks so every NPC's memory is full and recording evicts.
+static void BM_NPCManagerUpdate(benchmark::State& state) {
+    Forge::NPCNeedsStorage needs;
+    Forge::NPCManager manager;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> level(0.0f, 1.0f);
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        auto npc = std::make_unique<Forge::AdvancedNPC>("V" + std::to_string(i), Forge::NPCTraits{5, 5, 5, 5}, needs);
+        const Forge::NPCNeedsRef slot = npc->GetNeeds();
+        slot.hunger() = level(rng);
+        slot.energy() = level(rng);
+        slot.socialNeed() = level(rng);
+        manager.AddNPC(std::move(npc), static_cast<Forge::NPCPersonality>(i % 6));
+    }
+    for (size_t i = 0; i <= Forge::NPCMemory::Capacity; ++i) {
+        manager.Update(0.016f);
+    }
+
+    size_t allocations = 0;
+    for (auto _ : state) {
+        const size_t before = t_threadAllocations;
+        manager.Update(0.016f);
+        allocations += t_threadAllocations - before;
+        benchmark::ClobberMemory();
+    }
+    const double updates = static_cast<double>(state.iterations()) * state.range(0);
+    state.counters["allocs_per_npc"] = allocations / updates;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NPCManagerUpdate)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// One needs tick for every NPC: the SoA kernel, the same arrays one scalar
+// clamp at a time, and the old layout of per-NPC heap objects
+static void BM_NeedsKernel(benchmark::State& state) {
+    Forge::NPCNeedsStorage needs;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        needs.allocate();
+    }
+    for (auto _ : state) {
+        needs.advance(0.016f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NeedsKernel)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+static void BM_NeedsScalar(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::vector<float> hunger(count, 0.0f), energy(count, 1.0f), social(count, 0.0f), work(count, 0.5f);
+    for (auto _ : state) {
+        Forge::AdvanceNeedsScalar(hunger.data(), energy.data(), social.data(), work.data(), count, 0.016f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NeedsScalar)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+struct HeapNeeds {
+    float hunger = 0.0f;
+    float energy = 1.0f;
+    float socialNeed = 0.0f;
+    float workMotivation = 0.5f;
+    char otherState[96] = {};
+};
+
+static void BM_NeedsPerObject(benchmark::State& state) {
+    std::vector<std::unique_ptr<HeapNeeds>> npcs;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        npcs.push_back(std::make_unique<HeapNeeds>());
+    }
+    std::shuffle(npcs.begin(), npcs.end(), std::mt19937(42));
+    for (auto _ : state) {
+        for (auto& npc : npcs) {
+            npc->hunger = std::clamp(npc->hunger + 0.01f * 0.016f, 0.0f, 1.0f);
+            npc->energy = std::clamp(npc->energy - 0.005f * 0.016f, 0.0f, 1.0f);
+            npc->socialNeed = std::clamp(npc->socialNeed + 0.005f * 0.016f, 0.0f, 1.0f);
+            npc->workMotivation = std::clamp(npc->workMotivation - 0.002f * 0.016f, 0.0f, 1.0f);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_NeedsPerObject)->Arg(10000)->Arg(100000)->Arg(1000000);
+
+// Birth/death churn over a steady population of 1000 villagers: one death
+// and one birth per cycle, 1M cycles per iteration
+static constexpr size_t ChurnPopulation = 1000;
+static constexpr int64_t ChurnCycles = 1000000;
+static const Forge::GeneticTraits ChurnTraits{0.7f, 0.7f, 0.7f, 0.7f, 0.7f, 0.7f};
+
+static void BM_PopulationPoolChurn(benchmark::State& state) {
+    Forge::PopulationPool population;
+    for (size_t i = 0; i < ChurnPopulation; ++i) {
+        population.create("V" + std::to_string(i), ChurnTraits);
+    }
+    size_t allocations = 0;
+    for (auto _ : state) {
+        const size_t before = t_threadAllocations;
+        for (int64_t cycle = 0; cycle < ChurnCycles; ++cycle) {
+            population.release(population.handleAt(static_cast<size_t>(cycle) % ChurnPopulation));
+            population.create("Child", ChurnTraits);
+        }
+        allocations += t_threadAllocations - before;
+    }
+    state.SetItemsProcessed(state.iterations() * ChurnCycles);
+    state.counters["allocs_per_cycle"] =
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * ChurnCycles);
+}
+BENCHMARK(BM_PopulationPoolChurn)->Unit(benchmark::kMillisecond);
+
+static void BM_PopulationHeapChurn(benchmark::State& state) {
+    std::vector<std::unique_ptr<Forge::PopulationNPC>> population;
+    for (size_t i = 0; i < ChurnPopulation; ++i) {
+        population.push_back(std::make_unique<Forge::PopulationNPC>("V" + std::to_string(i), ChurnTraits));
+    }
+    size_t allocations = 0;
+    for (auto _ : state) {
+        const size_t before = t_threadAllocations;
+        for (int64_t cycle = 0; cycle < ChurnCycles; ++cycle) {
+            auto& slot = population[static_cast<size_t>(cycle) % ChurnPopulation];
+            slot.reset();
+            slot = std::make_unique<Forge::PopulationNPC>("Child", ChurnTraits);
+        }
+        allocations += t_threadAllocations - before;
+    }
+    state.SetItemsProcessed(state.iterations() * ChurnCycles);
+    state.counters["allocs_per_cycle"] =
+        static_cast<double>(allocations) / static_cast<double>(state.iterations() * ChurnCycles);
+}
+BENCHMARK(BM_PopulationHeapChurn)->Unit(benchmark::kMillisecond);
+
+// Profiler Benchmarks
+// Cost of one empty PROFILE_SCOPE on the recording thread, with every thread
+// recording at once. Thread 0 merges periodically like the frame loop does,
+// outside the timed region; the merge is endFrame()'s cost, not the scope's.
+static void BM_ProfileScope(benchmark::State& state) {
+    int64_t iterations = 0;
+    for (auto _ : state) {
+        PROFILE_SCOPE("Benchmark_EmptyScope");
+        if (state.thread_index() == 0 && (++iterations & 0x3fff) == 0) {
+            state.PauseTiming();
+            ForgeEngine::Core::Profiler::getInstance().endFrame();
+            state.ResumeTiming();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ProfileScope)->ThreadRange(1, 8);
+
+// One timestamp read; a scope takes two
+static void BM_ProfileTimestamp(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ForgeEngine::Core::Profiler::ticks());
+    }
+}
+BENCHMARK(BM_ProfileTimestamp);
+
+// Threading Benchmarks
+// Many tiny tasks, half submitted from outside the pool and half spawned by
+// workers, to measure scheduler overhead rather than task cost.
+static void BM_ThreadPoolContention(benchmark::State& state) {
+    const size_t threadCount = static_cast<size_t>(state.range(0));
+    const int rootTasks = 64;
+    const int childrenPerRoot = 256;
+    ForgeEngine::Core::ThreadPool pool(threadCount);
+    std::atomic<int> completed{0};
+
+    for (auto _ : state) {
+        completed = 0;
+        for (int i = 0; i < rootTasks; ++i) {
+            pool.enqueue([&pool, &completed, childrenPerRoot]() {
+                for (int c = 0; c < childrenPerRoot; ++c) {
+                    pool.enqueue([&completed]() {
+                        completed.fetch_add(1, std::memory_order_relaxed);
+                    });
+                }
+                completed.fetch_add(1, std::memory_order_relaxed);
+            });
+        }
+
+        const int expected = rootTasks * (childrenPerRoot + 1);
+        while (completed.load(std::memory_order_relaxed) < expected) {
+            std::this_thread::yield();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * rootTasks * (childrenPerRoot + 1));
+}
+BENCHMARK(BM_ThreadPoolContention)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+
+// Heap allocations per fire-and-forget task. "caller" counts what the
+// submitting thread pays, "total" includes the workers.
+template<bool UsePost>
+static void BM_ThreadPoolTaskAllocations(benchmark::State& state) {
+    const int tasksPerIteration = 1024;
+    ForgeEngine::Core::ThreadPool pool(4);
+    std::atomic<int> completed{0};
+
+    auto submitBatch = [&]() {
+        completed = 0;
+        for (int i = 0; i < tasksPerIteration; ++i) {
+            if constexpr (UsePost) {
+                pool.post([&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+            } else {
+                pool.enqueue([&completed]() { completed.fetch_add(1, std::memory_order_relaxed); });
+            }
+        }
+        while (completed.load(std::memory_order_relaxed) < tasksPerIteration) {
+            std::this_thread::yield();
+        }
+    };
+
+    // Let the worker deques reach their working size first
+    submitBatch();
+
+    size_t callerAllocations = 0;
+    size_t totalAllocations = 0;
+    for (auto _ : state) {
+        const size_t callerBefore = t_threadAllocations;
+        const size_t totalBefore = g_totalAllocations.load();
+        submitBatch();
+        callerAllocations += t_threadAllocations - callerBefore;
+        totalAllocations += g_totalAllocations.load() - totalBefore;
+    }
+
+    const double tasks = static_cast<double>(state.iterations()) * tasksPerIteration;
+    state.counters["caller_allocs_per_task"] = callerAllocations / tasks;
+    state.counters["total_allocs_per_task"] = totalAllocations / tasks;
+    state.SetItemsProcessed(state.iterations() * tasksPerIteration);
+}
+BENCHMARK_TEMPLATE(BM_ThreadPoolTaskAllocations, true)->Name("BM_ThreadPoolPostAllocations");
+BENCHMARK_TEMPLATE(BM_ThreadPoolTaskAllocations, false)->Name("BM_ThreadPoolEnqueueAllocations");
+
+// Economy Benchmarks
+// One economic cycle over 100k agents, sharded across 1-32 workers
+static void BM_VillageEconomyCycle(benchmark::State& state) {
+    auto threadPool = std::make_shared<ForgeEngine::Core::ThreadPool>(
+        static_cast<size_t>(state.range(0)));
+    Forge::VillageEconomy economy(100000, threadPool);
+
+    for (auto _ : state) {
+        economy.SimulateEconomicCycle(1.0f);
+    }
+
+    state.SetItemsProcessed(state.iterations() * 100000);
 }
-BENCHMARK(BM_ObjectPoolAllocation);
+BENCHMARK(BM_VillageEconomyCycle)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
 
 // Village System Benchmarks
 static void BM_VillageInteraction(benchmark::State& state) {
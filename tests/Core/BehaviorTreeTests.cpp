@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/BehaviorTree.h"
+#include <memory>
+
+using namespace ForgeEngine::Core;
+
+namespace {
+
+struct TestAgent {
+    int gathered = 0;
+    int worked = 0;
+    int workTicksLeft = 0;
+};
+
+using Tree = BehaviorTree<TestAgent>;
+using Action = ActionNode<TestAgent>;
+using Sequence = SequenceNode<TestAgent>;
+
+BehaviorStatus gather(TestAgent& agent, BehaviorBlackboard&) {
+    ++agent.gathered;
+    return BehaviorStatus::Success;
+}
+
+// Takes workTicksLeft + 1 executions to finish
+BehaviorStatus work(TestAgent& agent, BehaviorBlackboard&) {
+    ++agent.worked;
+    if (agent.workTicksLeft > 0) {
+        --agent.workTicksLeft;
+        return BehaviorStatus::Running;
+    }
+    return BehaviorStatus::Success;
+}
+
+BehaviorStatus fail(TestAgent&, BehaviorBlackboard&) {
+    return BehaviorStatus::Failure;
+}
+
+std::unique_ptr<Tree> gatherThenWork() {
+    auto root = std::make_unique<Sequence>();
+    root->add(std::make_unique<Action>(gather)).add(std::make_unique<Action>(work));
+    return std::make_unique<Tree>(std::move(root));
+}
+
+} // namespace
+
+TEST_CASE("BehaviorTree Execution", "[BehaviorTree]") {
+    const auto tree = gatherThenWork();
+    REQUIRE(tree->rootNode().type() == BehaviorNodeType::Sequence);
+
+    SECTION("Sequence Runs Children In Order") {
+        TestAgent agent;
+        BehaviorBlackboard blackboard;
+        REQUIRE(tree->execute(agent, blackboard) == BehaviorStatus::Success);
+        REQUIRE(agent.gathered == 1);
+        REQUIRE(agent.worked == 1);
+    }
+
+    SECTION("Running Child Resumes Without Restarting") {
+        TestAgent agent;
+        agent.workTicksLeft = 2;
+        BehaviorBlackboard blackboard;
+        REQUIRE(tree->execute(agent, blackboard) == BehaviorStatus::Running);
+        REQUIRE(tree->execute(agent, blackboard) == BehaviorStatus::Running);
+        REQUIRE(tree->execute(agent, blackboard) == BehaviorStatus::Success);
+        REQUIRE(agent.gathered == 1);
+        REQUIRE(agent.worked == 3);
+
+        // Finished, so the next run starts over
+        REQUIRE(tree->execute(agent, blackboard) == BehaviorStatus::Success);
+        REQUIRE(agent.gathered == 2);
+    }
+
+    SECTION("Agents Sharing A Tree Keep Separate Progress") {
+        TestAgent busy;
+        busy.workTicksLeft = 1;
+        TestAgent idle;
+        BehaviorBlackboard busyBoard;
+        BehaviorBlackboard idleBoard;
+        REQUIRE(tree->execute(busy, busyBoard) == BehaviorStatus::Running);
+        REQUIRE(tree->execute(idle, idleBoard) == BehaviorStatus::Success);
+        REQUIRE(tree->execute(busy, busyBoard) == BehaviorStatus::Success);
+        REQUIRE(busy.gathered == 1);
+        REQUIRE(idle.gathered == 1);
+    }
+
+    SECTION("Switching Trees Drops Resume Points") {
+        const auto other = gatherThenWork();
+        TestAgent agent;
+        agent.workTicksLeft = 5;
+        BehaviorBlackboard blackboard;
+        REQUIRE(tree->execute(agent, blackboard) == BehaviorStatus::Running);
+        agent.workTicksLeft = 0;
+        REQUIRE(other->execute(agent, blackboard) == BehaviorStatus::Success);
+        REQUIRE(agent.gathered == 2);
+    }
+}
+
+TEST_CASE("BehaviorTree Construction", "[BehaviorTree]") {
+    SECTION("Failure Stops A Sequence") {
+        auto root = std::make_unique<Sequence>();
+        root->add(std::make_unique<Action>(fail)).add(std::make_unique<Action>(gather));
+        const Tree tree(std::move(root));
+        TestAgent agent;
+        BehaviorBlackboard blackboard;
+        REQUIRE(tree.execute(agent, blackboard) == BehaviorStatus::Failure);
+        REQUIRE(agent.gathered == 0);
+    }
+
+    SECTION("Nested Sequences Use Their Own Resume Points") {
+        auto inner = std::make_unique<Sequence>();
+        inner->add(std::make_unique<Action>(gather)).add(std::make_unique<Action>(work));
+        auto root = std::make_unique<Sequence>();
+        root->add(std::make_unique<Action>(gather)).add(std::move(inner));
+        const Tree tree(std::move(root));
+
+        TestAgent agent;
+        agent.workTicksLeft = 1;
+        BehaviorBlackboard blackboard;
+        REQUIRE(tree.execute(agent, blackboard) == BehaviorStatus::Running);
+        REQUIRE(tree.execute(agent, blackboard) == BehaviorStatus::Success);
+        REQUIRE(agent.gathered == 2);
+        REQUIRE(agent.worked == 2);
+    }
+
+    SECTION("Too Many Composites Throws") {
+        auto root = std::make_unique<Sequence>();
+        Sequence* parent = root.get();
+        for (size_t i = 0; i < BehaviorBlackboard::MaxComposites; ++i) {
+            auto child = std::make_unique<Sequence>();
+            Sequence* next = child.get();
+            parent->add(std::move(child));
+            parent = next;
+        }
+        REQUIRE_THROWS_AS(Tree(std::move(root)), std::length_error);
+    }
+}
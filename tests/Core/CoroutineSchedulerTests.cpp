@@ -0,0 +1,242 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/CoroutineScheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+namespace {
+
+// Starts task on the calling thread and hands its result to the future. The
+// task is destroyed first so nothing of it is touched once the test resumes.
+template<typename T>
+DetachedTask runInto(Task<T> task, std::promise<T>& result) {
+    std::exception_ptr error;
+    std::optional<std::conditional_t<std::is_void_v<T>, std::monostate, T>> value;
+    {
+        Task<T> owned = std::move(task);
+        try {
+            if constexpr (std::is_void_v<T>) {
+                co_await owned;
+                value.emplace();
+            } else {
+                value.emplace(co_await owned);
+            }
+        } catch (...) {
+            error = std::current_exception();
+        }
+    }
+
+    if (error) {
+        result.set_exception(std::move(error));
+    } else if constexpr (std::is_void_v<T>) {
+        result.set_value();
+    } else {
+        result.set_value(std::move(*value));
+    }
+}
+
+// Awaits task and reports what it threw. Only the message crosses back to
+// the test thread, never the exception object itself.
+DetachedTask catchMessage(Task<std::vector<int>> task, std::promise<std::string>& message) {
+    std::string caught;
+    try {
+        co_await task;
+    } catch (const std::exception& e) {
+        caught = e.what();
+    }
+    message.set_value(std::move(caught));
+}
+
+Task<int> delayedValue(int value, int delayMs) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+    co_return value;
+}
+
+Task<int> delayedThrow(std::string message, int delayMs) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+    throw std::runtime_error(message);
+    co_return 0;
+}
+
+Task<int> countedValue(int value, std::atomic<int>& finished) {
+    ++finished;
+    co_return value;
+}
+
+Task<void> countedVoid(std::atomic<int>& finished) {
+    ++finished;
+    co_return;
+}
+
+DetachedTask wakeAfterDays(CoroutineScheduler& scheduler, float days, int id,
+                           std::mutex& logMutex, std::vector<int>& log) {
+    co_await scheduler.afterDays(days);
+    std::lock_guard<std::mutex> lock(logMutex);
+    log.push_back(id);
+}
+
+DetachedTask wakeNextFrame(CoroutineScheduler& scheduler, std::atomic<int>& woken) {
+    co_await scheduler.nextFrame();
+    ++woken;
+}
+
+} // namespace
+
+TEST_CASE("CoroutineScheduler WhenAll", "[CoroutineScheduler]") {
+    CoroutineScheduler scheduler(std::make_shared<ThreadPool>(4));
+
+    SECTION("Results Keep Input Order") {
+        // Later inputs finish first
+        std::vector<Task<int>> tasks;
+        for (int i = 0; i < 6; ++i) {
+            tasks.push_back(delayedValue(i * 10, (6 - i) * 5));
+        }
+
+        std::promise<std::vector<int>> result;
+        auto future = result.get_future();
+        runInto(scheduler.whenAll(std::move(tasks)), result);
+
+        REQUIRE(future.get() == std::vector<int>{0, 10, 20, 30, 40, 50});
+    }
+
+    SECTION("First Exception Is Rethrown After Every Task Finishes") {
+        std::atomic<int> finished{0};
+        std::vector<Task<int>> tasks;
+        tasks.push_back(delayedThrow("second", 50));
+        tasks.push_back(delayedThrow("first", 0));
+        tasks.push_back(countedValue(1, finished));
+
+        std::promise<std::string> message;
+        auto future = message.get_future();
+        catchMessage(scheduler.whenAll(std::move(tasks)), message);
+
+        REQUIRE(future.get() == "first");
+        REQUIRE(finished.load() == 1);
+    }
+
+    SECTION("Empty Input Completes Without Suspending") {
+        std::promise<std::vector<int>> values;
+        auto valuesFuture = values.get_future();
+        runInto(scheduler.whenAll(std::vector<Task<int>>{}), values);
+
+        std::promise<void> done;
+        auto doneFuture = done.get_future();
+        runInto(scheduler.whenAll(std::vector<Task<void>>{}), done);
+
+        // Both finished on this thread before runInto returned
+        REQUIRE(valuesFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        REQUIRE(valuesFuture.get().empty());
+        REQUIRE(doneFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+        REQUIRE_NOTHROW(doneFuture.get());
+    }
+
+    SECTION("Children Finishing Before The Waiter Suspends") {
+        // Trivial children race the awaiting coroutine to the latch; the
+        // extra count keeps it from being resumed before it has suspended
+        for (int round = 0; round < 200; ++round) {
+            std::atomic<int> finished{0};
+            std::vector<Task<int>> values;
+            std::vector<Task<void>> voids;
+            for (int i = 0; i < 8; ++i) {
+                values.push_back(countedValue(i, finished));
+                voids.push_back(countedVoid(finished));
+            }
+
+            std::promise<std::vector<int>> valuesResult;
+            auto valuesFuture = valuesResult.get_future();
+            runInto(scheduler.whenAll(std::move(values)), valuesResult);
+
+            std::promise<void> voidsResult;
+            auto voidsFuture = voidsResult.get_future();
+            runInto(scheduler.whenAll(std::move(voids)), voidsResult);
+
+            REQUIRE(valuesFuture.get() == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7});
+            voidsFuture.get();
+            REQUIRE(finished.load() == 16);
+        }
+    }
+}
+
+TEST_CASE("CoroutineScheduler Timers", "[CoroutineScheduler]") {
+    CoroutineScheduler scheduler(std::make_shared<ThreadPool>(2));
+    std::mutex logMutex;
+    std::vector<int> log;
+
+    auto snapshot = [&]() {
+        std::lock_guard<std::mutex> lock(logMutex);
+        return log;
+    };
+
+    SECTION("Timers Wake In Order Of Their Due Day") {
+        wakeAfterDays(scheduler, 3.0f, 3, logMutex, log);
+        wakeAfterDays(scheduler, 1.0f, 1, logMutex, log);
+        wakeAfterDays(scheduler, 2.0f, 2, logMutex, log);
+
+        scheduler.advanceFrame(0.5f);
+        REQUIRE(snapshot().empty());
+        scheduler.advanceFrame(0.5f);
+        REQUIRE(snapshot() == std::vector<int>{1});
+        scheduler.advanceFrame(1.0f);
+        REQUIRE(snapshot() == std::vector<int>{1, 2});
+        scheduler.advanceFrame(1.0f);
+        REQUIRE(snapshot() == std::vector<int>{1, 2, 3});
+        REQUIRE(scheduler.simulationTime() == Approx(3.0f));
+    }
+
+    SECTION("One Long Frame Wakes Every Timer That Has Passed") {
+        wakeAfterDays(scheduler, 1.0f, 1, logMutex, log);
+        wakeAfterDays(scheduler, 2.0f, 2, logMutex, log);
+        wakeAfterDays(scheduler, 10.0f, 10, logMutex, log);
+
+        scheduler.advanceFrame(5.0f);
+        auto woken = snapshot();
+        std::sort(woken.begin(), woken.end());
+        REQUIRE(woken == std::vector<int>{1, 2});
+
+        scheduler.advanceFrame(5.0f);
+        REQUIRE(snapshot().size() == 3);
+    }
+
+    SECTION("Timers Count From When They Were Set") {
+        scheduler.advanceFrame(4.0f);
+        wakeAfterDays(scheduler, 1.0f, 1, logMutex, log);
+
+        scheduler.advanceFrame(0.5f);
+        REQUIRE(snapshot().empty());
+        scheduler.advanceFrame(0.5f);
+        REQUIRE(snapshot() == std::vector<int>{1});
+    }
+
+    SECTION("Zero Days Does Not Suspend") {
+        wakeAfterDays(scheduler, 0.0f, 7, logMutex, log);
+        REQUIRE(snapshot() == std::vector<int>{7});
+    }
+
+    SECTION("Next Frame Wakes On The Following Advance Only") {
+        std::atomic<int> woken{0};
+        wakeNextFrame(scheduler, woken);
+        wakeNextFrame(scheduler, woken);
+        REQUIRE(woken.load() == 0);
+
+        scheduler.advanceFrame(0.0f);
+        REQUIRE(woken.load() == 2);
+
+        wakeNextFrame(scheduler, woken);
+        scheduler.advanceFrame(0.0f);
+        scheduler.advanceFrame(0.0f);
+        REQUIRE(woken.load() == 3);
+    }
+}
@@ -0,0 +1,145 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/ECS.h"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+namespace {
+struct Position { float x = 0.0f; float y = 0.0f; };
+struct Velocity { float dx = 0.0f; float dy = 0.0f; };
+struct Label { std::string text; };
+}
+
+TEST_CASE("ECS World", "[ECS]") {
+    World world;
+
+    SECTION("Create, Get And Destroy") {
+        auto mover = world.create(Position{1.0f, 2.0f}, Velocity{3.0f, 4.0f});
+        auto label = world.create(Position{}, Label{"sign"});
+        REQUIRE(world.size() == 2);
+        REQUIRE(world.get<Position>(mover)->y == 2.0f);
+        REQUIRE(world.get<Label>(label)->text == "sign");
+        REQUIRE(world.get<Velocity>(label) == nullptr);
+
+        REQUIRE(world.destroy(mover));
+        REQUIRE_FALSE(world.alive(mover));
+        REQUIRE_FALSE(world.destroy(mover));
+        REQUIRE(world.get<Position>(mover) == nullptr);
+
+        // The index is reused under a new generation
+        auto reused = world.create(Position{});
+        REQUIRE(reused.index == mover.index);
+        REQUIRE_FALSE(world.alive(mover));
+    }
+
+    SECTION("Destroy Keeps Other Entities Intact") {
+        std::vector<Entity> entities;
+        for (int i = 0; i < 2000; ++i) {
+            entities.push_back(world.create(Position{static_cast<float>(i), 0.0f}, Label{std::to_string(i)}));
+        }
+        for (int i = 0; i < 2000; i += 3) {
+            world.destroy(entities[i]);
+        }
+        for (int i = 0; i < 2000; ++i) {
+            if (i % 3 != 0) {
+                REQUIRE(world.get<Position>(entities[i])->x == static_cast<float>(i));
+                REQUIRE(world.get<Label>(entities[i])->text == std::to_string(i));
+            }
+        }
+    }
+
+    SECTION("Add And Remove Move Between Archetypes") {
+        auto entity = world.create(Position{5.0f, 0.0f}, Label{"npc"});
+        world.add<Velocity>(entity, Velocity{1.0f, 0.0f});
+        REQUIRE(world.has<Velocity>(entity));
+        REQUIRE(world.get<Label>(entity)->text == "npc");
+
+        REQUIRE(world.remove<Label>(entity));
+        REQUIRE_FALSE(world.has<Label>(entity));
+        REQUIRE(world.get<Position>(entity)->x == 5.0f);
+        REQUIRE_FALSE(world.remove<Label>(entity));
+    }
+
+    SECTION("Move-Only Components Are Destroyed With The World") {
+        auto tracked = std::make_shared<int>(0);
+        {
+            World owners;
+            owners.create(tracked, Position{});
+            owners.create(tracked);
+            REQUIRE(tracked.use_count() == 3);
+        }
+        REQUIRE(tracked.use_count() == 1);
+    }
+}
+
+TEST_CASE("ECS Queries", "[ECS]") {
+    World world;
+    for (int i = 0; i < 1000; ++i) {
+        if (i % 2 == 0) {
+            world.create(Position{}, Velocity{1.0f, 2.0f});
+        } else {
+            world.create(Position{}, Velocity{1.0f, 2.0f}, Label{"tagged"});
+        }
+    }
+    world.create(Position{});
+
+    SECTION("Match Every Archetype With The Components") {
+        auto& movers = world.query<Position, const Velocity>();
+        REQUIRE(movers.size() == 1000);
+        movers.forEach([](Position& position, const Velocity& velocity) {
+            position.x += velocity.dx;
+        });
+        size_t moved = 0;
+        world.query<const Position>().forEach([&moved](const Position& position) {
+            moved += position.x == 1.0f ? 1 : 0;
+        });
+        REQUIRE(moved == 1000);
+
+        // Archetypes created after the query are picked up
+        world.create(Position{}, Velocity{}, std::string("late"));
+        REQUIRE(movers.size() == 1001);
+    }
+
+    SECTION("Chunks Cover Every Entity Once") {
+        size_t total = 0;
+        world.query<Position, Velocity>().forEachChunk(
+            [&total](size_t count, const Entity* entities, Position*, Velocity*) {
+                REQUIRE(entities != nullptr);
+                total += count;
+            });
+        REQUIRE(total == 1000);
+    }
+
+    SECTION("Parallel Passes Touch Every Entity") {
+        ThreadPool pool(4);
+        world.query<Position>().parallelForEach(pool, [](Position& position) {
+            position.y = 7.0f;
+        });
+        world.query<const Position>().forEach([](const Position& position) {
+            REQUIRE(position.y == 7.0f);
+        });
+    }
+
+    SECTION("Structural Changes During Iteration Throw") {
+        REQUIRE_THROWS_AS(world.query<Position>().forEach([&world](Entity entity, Position&) {
+            world.destroy(entity);
+        }), std::logic_error);
+    }
+
+    SECTION("Command Buffers Defer Structural Changes") {
+        CommandBuffer commands(world);
+        world.query<const Velocity>().forEach([&commands](Entity entity, const Velocity&) {
+            commands.destroy(entity);
+        });
+        commands.create(Label{"spawned"});
+        REQUIRE(world.size() == 1001);
+
+        commands.playback();
+        REQUIRE(commands.empty());
+        REQUIRE(world.size() == 2);
+        REQUIRE(world.query<Label>().size() == 1);
+    }
+}
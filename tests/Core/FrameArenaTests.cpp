@@ -0,0 +1,52 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/FrameArena.h"
+#include <cstdint>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+TEST_CASE("FrameArena Allocation", "[FrameArena]") {
+    FrameArena arena(256);
+
+    SECTION("Respects Alignment") {
+        REQUIRE(arena.allocate(3, 1) != nullptr);
+        void* aligned = arena.allocate(64, 64);
+        REQUIRE(reinterpret_cast<uintptr_t>(aligned) % 64 == 0);
+    }
+
+    SECTION("Grows Past One Block") {
+        std::pmr::vector<int> values(&arena);
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(i);
+        }
+        REQUIRE(values[999] == 999);
+        REQUIRE(arena.capacity() > 256);
+    }
+
+    SECTION("Reset Merges Blocks For The Next Frame") {
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(arena.allocate(200, 8) != nullptr);
+        }
+        const size_t capacity = arena.capacity();
+        arena.reset();
+        REQUIRE(arena.bytesUsed() == 0);
+        REQUIRE(arena.capacity() == capacity);
+
+        // The same workload now fits without new blocks
+        for (int i = 0; i < 8; ++i) {
+            REQUIRE(arena.allocate(200, 8) != nullptr);
+        }
+        REQUIRE(arena.capacity() == capacity);
+    }
+}
+
+TEST_CASE("FrameArena Frames", "[FrameArena]") {
+    FrameArena& arena = FrameArena::local();
+    REQUIRE(arena.allocate(128, 8) != nullptr);
+    REQUIRE(arena.bytesUsed() >= 128);
+    REQUIRE(&FrameArena::local() == &arena);
+    REQUIRE(FrameArena::local().bytesUsed() >= 128);
+
+    FrameArena::endFrame();
+    REQUIRE(FrameArena::local().bytesUsed() == 0);
+}
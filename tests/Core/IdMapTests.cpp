@@ -0,0 +1,93 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/EntityRegistry.h"
+#include "../../src/Core/IdMap.h"
+#include <map>
+#include <random>
+
+using namespace ForgeEngine::Core;
+
+TEST_CASE("IdMap Operations", "[IdMap]") {
+    IdMap<float> map;
+
+    SECTION("Missing Keys") {
+        REQUIRE(map.find(7) == nullptr);
+        REQUIRE_FALSE(map.erase(7));
+        REQUIRE(map.empty());
+    }
+
+    SECTION("Insert And Update") {
+        map[3] = 0.5f;
+        map[3] += 0.25f;
+        REQUIRE(map.size() == 1);
+        REQUIRE(*map.find(3) == 0.75f);
+        REQUIRE(map[4] == 0.0f);
+        REQUIRE(map.size() == 2);
+    }
+
+    SECTION("Matches std::map Under Random Churn") {
+        std::map<uint32_t, float> reference;
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<uint32_t> keys(0, 512);
+        for (int i = 0; i < 20000; ++i) {
+            const uint32_t key = keys(rng);
+            if (rng() % 3 == 0) {
+                REQUIRE(map.erase(key) == (reference.erase(key) == 1));
+            } else {
+                map[key] = static_cast<float>(i);
+                reference[key] = static_cast<float>(i);
+            }
+        }
+        REQUIRE(map.size() == reference.size());
+        for (uint32_t key = 0; key <= 512; ++key) {
+            auto it = reference.find(key);
+            const float* value = map.find(key);
+            REQUIRE((value != nullptr) == (it != reference.end()));
+            if (value) {
+                REQUIRE(*value == it->second);
+            }
+        }
+        size_t visited = 0;
+        map.forEach([&](uint32_t key, float value) {
+            REQUIRE(reference.at(key) == value);
+            ++visited;
+        });
+        REQUIRE(visited == reference.size());
+    }
+
+    SECTION("Reserve Avoids Rehash") {
+        map.reserve(100);
+        const size_t capacity = map.capacity();
+        for (uint32_t key = 0; key < 100; ++key) {
+            map[key] = 1.0f;
+        }
+        REQUIRE(map.capacity() == capacity);
+    }
+}
+
+TEST_CASE("EntityRegistry Names", "[IdMap]") {
+    EntityRegistry registry;
+
+    const EntityId ada = registry.acquire("Ada");
+    const EntityId bram = registry.acquire("Bram");
+    REQUIRE(ada != bram);
+    REQUIRE(registry.size() == 2);
+    REQUIRE(registry.find("Bram") == bram);
+    REQUIRE(registry.name(ada) == "Ada");
+
+    SECTION("IDs Are Never Reused") {
+        registry.release(ada);
+        REQUIRE(registry.find("Ada") == InvalidEntityId);
+        REQUIRE(registry.name(ada).empty());
+        const EntityId next = registry.acquire("Ada");
+        REQUIRE(next != ada);
+        REQUIRE(registry.find("Ada") == next);
+    }
+
+    SECTION("Duplicate Names Resolve To The Newest") {
+        const EntityId second = registry.acquire("Ada");
+        REQUIRE(registry.find("Ada") == second);
+        registry.release(ada);
+        REQUIRE(registry.find("Ada") == second);
+        REQUIRE(registry.size() == 2);
+    }
+}
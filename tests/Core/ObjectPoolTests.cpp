@@ -0,0 +1,156 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/ObjectPool.h"
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+namespace {
+
+struct PooledItem {
+    std::atomic<bool> inUse{false};
+    std::atomic<int> resets{0};
+
+    void reset() { ++resets; }
+};
+
+// Marks an acquired object and counts it if it was already handed out
+PooledItem* take(ObjectPool<PooledItem>& pool, std::atomic<int>& handedOutTwice) {
+    PooledItem* item = pool.acquire();
+    if (item->inUse.exchange(true)) {
+        ++handedOutTwice;
+    }
+    return item;
+}
+
+void giveBack(ObjectPool<PooledItem>& pool, PooledItem* item) {
+    item->inUse = false;
+    pool.release(item);
+}
+
+} // namespace
+
+TEST_CASE("ObjectPool Threads", "[ObjectPool]") {
+    ObjectPool<PooledItem> pool(64);
+    std::atomic<int> handedOutTwice{0};
+
+    SECTION("Concurrent Acquire And Release") {
+        constexpr int ThreadCount = 8;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < ThreadCount; ++t) {
+            threads.emplace_back([&pool, &handedOutTwice, t]() {
+                std::vector<PooledItem*> held;
+                for (int round = 0; round < 500; ++round) {
+                    // Batches larger than two magazines force depot trades
+                    const size_t batch = 1 + (round * 7 + t * 13) % (3 * ObjectPool<PooledItem>::MagazineSize);
+                    for (size_t i = 0; i < batch; ++i) {
+                        held.push_back(take(pool, handedOutTwice));
+                    }
+                    // Keep a few across rounds so caches drift out of step
+                    while (held.size() > 5) {
+                        giveBack(pool, held.back());
+                        held.pop_back();
+                    }
+                }
+                for (PooledItem* item : held) {
+                    giveBack(pool, item);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        REQUIRE(handedOutTwice.load() == 0);
+        REQUIRE(pool.availableCount() == pool.totalCount());
+
+        // No object sits in two free lists. Objects cached by the exited
+        // threads stay with their slots, so this may grow the pool.
+        std::set<PooledItem*> distinct;
+        std::vector<PooledItem*> all;
+        const size_t total = pool.totalCount();
+        for (size_t i = 0; i < total; ++i) {
+            all.push_back(take(pool, handedOutTwice));
+            distinct.insert(all.back());
+        }
+        REQUIRE(handedOutTwice.load() == 0);
+        REQUIRE(distinct.size() == total);
+        REQUIRE(pool.availableCount() == pool.totalCount() - total);
+        for (PooledItem* item : all) {
+            giveBack(pool, item);
+        }
+        REQUIRE(pool.availableCount() == pool.totalCount());
+    }
+
+    SECTION("Exited Threads Hand Their Cache On") {
+        // Run one after another, so later threads reuse the slots and
+        // caches of earlier ones, each leaving objects outstanding
+        std::vector<PooledItem*> kept;
+        std::mutex keptMutex;
+        for (int t = 0; t < 2 * static_cast<int>(detail::PoolThreadSlots::MaxThreads); ++t) {
+            std::thread([&]() {
+                std::vector<PooledItem*> held;
+                for (int i = 0; i < 50; ++i) {
+                    held.push_back(take(pool, handedOutTwice));
+                }
+                for (int i = 0; i < 40; ++i) {
+                    giveBack(pool, held.back());
+                    held.pop_back();
+                }
+                std::lock_guard<std::mutex> lock(keptMutex);
+                kept.insert(kept.end(), held.begin(), held.end());
+            }).join();
+        }
+
+        REQUIRE(handedOutTwice.load() == 0);
+        REQUIRE(pool.availableCount() == pool.totalCount() - kept.size());
+        // What one thread left cached was reused by the next instead of
+        // being stranded with it
+        REQUIRE(pool.totalCount() <= kept.size() + 4 * ObjectPool<PooledItem>::MagazineSize);
+
+        // Released on another thread than the one that acquired them
+        for (PooledItem* item : kept) {
+            giveBack(pool, item);
+        }
+        REQUIRE(pool.availableCount() == pool.totalCount());
+    }
+
+    SECTION("Threads Beyond The Slot Limit Share A Cache") {
+        constexpr size_t ThreadCount = detail::PoolThreadSlots::MaxThreads + 16;
+        std::atomic<size_t> holding{0};
+        std::atomic<bool> release{false};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < ThreadCount; ++t) {
+            threads.emplace_back([&]() {
+                PooledItem* item = take(pool, handedOutTwice);
+                ++holding;
+                while (!release.load()) {
+                    std::this_thread::yield();
+                }
+                giveBack(pool, item);
+            });
+        }
+        while (holding.load() < ThreadCount) {
+            std::this_thread::yield();
+        }
+        REQUIRE(pool.availableCount() == pool.totalCount() - ThreadCount);
+
+        release = true;
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        REQUIRE(handedOutTwice.load() == 0);
+        REQUIRE(pool.availableCount() == pool.totalCount());
+    }
+}
+
+TEST_CASE("ObjectPool Reset", "[ObjectPool]") {
+    ObjectPool<PooledItem> pool(4);
+    PooledItem* item = pool.acquire();
+    pool.release(item);
+    pool.release(nullptr);
+    REQUIRE(item->resets.load() == 1);
+}
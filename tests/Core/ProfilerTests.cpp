@@ -0,0 +1,55 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+namespace {
+
+void overrunZoneA() {
+    PROFILE_SCOPE("Test_OverrunA");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+void overrunZoneB() {
+    PROFILE_SCOPE("Test_OverrunB");
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+} // namespace
+
+TEST_CASE("Profiler Budgets", "[Profiler]") {
+    Profiler& profiler = Profiler::getInstance();
+    profiler.endFrame();
+
+    SECTION("Handler May Add Budgets") {
+        // Short enough to live inside the budget's own std::string, which
+        // moves when the handler grows the budget list
+        std::vector<std::string> zones;
+        int added = 0;
+        profiler.setBudget("Test_OverrunA", 0.0);
+        profiler.setBudget("Test_OverrunB", 0.0);
+        profiler.setOverrunHandler([&](const Profiler::BudgetOverrun& overrun) {
+            zones.push_back(overrun.zone);
+            // Grows the budget list while later overruns are still pending
+            for (int i = 0; i < 16; ++i) {
+                profiler.setBudget("Test_Added" + std::to_string(added++), 1.0);
+            }
+        });
+
+        overrunZoneA();
+        overrunZoneB();
+        profiler.endFrame();
+
+        REQUIRE(zones.size() == 2);
+        REQUIRE(std::find(zones.begin(), zones.end(), "Test_OverrunA") != zones.end());
+        REQUIRE(std::find(zones.begin(), zones.end(), "Test_OverrunB") != zones.end());
+    }
+
+    profiler.setOverrunHandler(nullptr);
+    profiler.clearBudgets();
+}
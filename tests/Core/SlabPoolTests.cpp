@@ -0,0 +1,75 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/SlabPool.h"
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+TEST_CASE("SlabPool Handles", "[SlabPool]") {
+    SlabPool<std::string, 4> pool;
+
+    SECTION("Create And Access") {
+        auto first = pool.create("first");
+        auto second = pool.create(3, 'x');
+        REQUIRE(pool.size() == 2);
+        REQUIRE(pool.at(first) == "first");
+        REQUIRE(*pool.get(second) == "xxx");
+    }
+
+    SECTION("Released Handles Go Stale") {
+        auto handle = pool.create("npc");
+        REQUIRE(pool.release(handle));
+        REQUIRE_FALSE(pool.contains(handle));
+        REQUIRE(pool.get(handle) == nullptr);
+        REQUIRE_THROWS_AS(pool.at(handle), std::runtime_error);
+        REQUIRE_FALSE(pool.release(handle));
+
+        // The slot is reused under a new generation
+        auto reused = pool.create("other");
+        REQUIRE(reused.index == handle.index);
+        REQUIRE(reused.generation != handle.generation);
+        REQUIRE_FALSE(pool.contains(handle));
+        REQUIRE(pool.at(reused) == "other");
+    }
+
+    SECTION("Release Keeps Objects Packed") {
+        std::vector<SlabPool<std::string, 4>::Handle> handles;
+        for (int i = 0; i < 10; ++i) {
+            handles.push_back(pool.create(std::to_string(i)));
+        }
+        pool.release(handles[0]);
+        pool.release(handles[5]);
+        pool.release(handles[9]);
+
+        REQUIRE(pool.size() == 7);
+        REQUIRE(pool.pageCount() == 2);
+        std::set<std::string> seen;
+        pool.forEach([&seen](const std::string& value) { seen.insert(value); });
+        REQUIRE(seen == std::set<std::string>{"1", "2", "3", "4", "6", "7", "8"});
+
+        // Surviving handles still reach their own objects after the moves
+        for (int i : {1, 2, 3, 4, 6, 7, 8}) {
+            REQUIRE(pool.at(handles[i]) == std::to_string(i));
+        }
+        pool.forEachWithHandle([&pool](auto handle, const std::string& value) {
+            REQUIRE(pool.get(handle) == &value);
+        });
+    }
+
+    SECTION("Clear Destroys Everything") {
+        auto tracked = std::make_shared<int>(0);
+        {
+            SlabPool<std::shared_ptr<int>> owners;
+            auto handle = owners.create(tracked);
+            owners.create(tracked);
+            REQUIRE(tracked.use_count() == 3);
+            owners.clear();
+            REQUIRE(tracked.use_count() == 1);
+            REQUIRE_FALSE(owners.contains(handle));
+            owners.create(tracked);
+        }
+        REQUIRE(tracked.use_count() == 1);
+    }
+}
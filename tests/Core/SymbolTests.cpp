@@ -0,0 +1,65 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/Symbol.h"
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+TEST_CASE("Symbol Interning", "[Symbol]") {
+    SECTION("Equal Text Gives Equal Symbols") {
+        const Symbol a("Water Mill");
+        const Symbol b(std::string("Water") + " Mill");
+        REQUIRE(a == b);
+        REQUIRE(a.id() == b.id());
+        REQUIRE(a != Symbol("Steel Forging"));
+        REQUIRE(a.view() == "Water Mill");
+        REQUIRE(a.str() == "Water Mill");
+    }
+
+    SECTION("Empty Symbol") {
+        const Symbol empty;
+        REQUIRE(empty.empty());
+        REQUIRE(empty == Symbol(""));
+        REQUIRE(empty.view().empty());
+    }
+
+    SECTION("Find Does Not Intern") {
+        const size_t size = SymbolTable::global().size();
+        REQUIRE(Symbol::find("Never_Interned_Symbol").empty());
+        REQUIRE(SymbolTable::global().size() == size);
+        const Symbol latin("Latin");
+        REQUIRE(Symbol::find("Latin") == latin);
+    }
+
+    SECTION("Hashes By ID") {
+        std::unordered_set<Symbol> set{Symbol("Reading"), Symbol("Writing"), Symbol("Reading")};
+        REQUIRE(set.size() == 2);
+        REQUIRE(set.count(Symbol("Writing")) == 1);
+    }
+}
+
+TEST_CASE("Symbol Concurrent Interning", "[Symbol]") {
+    constexpr int ThreadCount = 8;
+    constexpr int Names = 500;
+    std::vector<std::vector<Symbol>> results(ThreadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < ThreadCount; ++t) {
+        threads.emplace_back([&results, t]() {
+            for (int i = 0; i < Names; ++i) {
+                results[t].emplace_back("Concurrent_" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 1; t < ThreadCount; ++t) {
+        REQUIRE(results[t] == results[0]);
+    }
+    for (int i = 0; i < Names; ++i) {
+        REQUIRE(results[0][i].str() == "Concurrent_" + std::to_string(i));
+    }
+}
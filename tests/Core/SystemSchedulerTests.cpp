@@ -0,0 +1,140 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/SystemScheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+namespace {
+
+// Records the order systems run in, from whichever thread runs them
+class RunLog {
+public:
+    std::function<void(float)> entry(std::string name) {
+        return [this, name = std::move(name)](float) {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        };
+    }
+
+    std::vector<std::string> get() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return order;
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<std::string> order;
+};
+
+} // namespace
+
+TEST_CASE("SystemScheduler Ordering", "[SystemScheduler]") {
+    RunLog log;
+
+    SECTION("Conflicting Systems Run In Registration Order") {
+        SystemScheduler scheduler(std::make_shared<ThreadPool>(4));
+        scheduler.addSystem({"Spawn", {}, {"Population"}, log.entry("Spawn")});
+        scheduler.addSystem({"Census", {"Population"}, {"Stats"}, log.entry("Census")});
+        scheduler.addSystem({"Weather", {}, {"Climate"}, log.entry("Weather")});
+        scheduler.addSystem({"Crops", {"Climate", "Stats"}, {"Food"}, log.entry("Crops")});
+        scheduler.addSystem({"Cull", {}, {"Population"}, log.entry("Cull")});
+
+        for (int frame = 0; frame < 50; ++frame) {
+            scheduler.run(0.016f);
+        }
+
+        // Each frame appends all five; check the constraints frame by frame
+        auto order = log.get();
+        REQUIRE(order.size() == 5 * 50);
+        for (size_t frame = 0; frame < 50; ++frame) {
+            std::vector<std::string> slice(order.begin() + frame * 5, order.begin() + frame * 5 + 5);
+            auto at = [&slice](const char* name) {
+                return std::find(slice.begin(), slice.end(), name) - slice.begin();
+            };
+            REQUIRE(at("Spawn") < at("Census"));    // write before read
+            REQUIRE(at("Census") < at("Cull"));     // read before later write
+            REQUIRE(at("Spawn") < at("Cull"));      // write before write
+            REQUIRE(at("Census") < at("Crops"));    // through Stats
+            REQUIRE(at("Weather") < at("Crops"));   // through Climate
+        }
+    }
+
+    SECTION("Independent Systems Run Concurrently") {
+        SystemScheduler scheduler(std::make_shared<ThreadPool>(2));
+        std::atomic<int> arrived{0};
+        std::atomic<bool> metOther{true};
+        // Each waits for the other; only possible if both run at once
+        auto rendezvous = [&](float) {
+            ++arrived;
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (arrived.load() < 2) {
+                if (std::chrono::steady_clock::now() > deadline) {
+                    metOther = false;
+                    return;
+                }
+                std::this_thread::yield();
+            }
+        };
+        scheduler.addSystem({"Villages", {"Terrain"}, {"Villages"}, rendezvous});
+        scheduler.addSystem({"Wildlife", {"Terrain"}, {"Animals"}, rendezvous});
+
+        scheduler.run(0.016f);
+        REQUIRE(metOther.load());
+    }
+
+    SECTION("Disabled Systems Are Dropped From The Graph") {
+        SystemScheduler scheduler(std::make_shared<ThreadPool>(2));
+        scheduler.addSystem({"First", {}, {"A"}, log.entry("First")});
+        scheduler.addSystem({"Second", {"A"}, {"B"}, log.entry("Second")});
+        scheduler.addSystem({"Third", {"B"}, {}, log.entry("Third")});
+
+        scheduler.setSystemEnabled("Second", false);
+        scheduler.run(0.016f);
+        auto order = log.get();
+        std::sort(order.begin(), order.end());
+        REQUIRE(order == std::vector<std::string>{"First", "Third"});
+
+        scheduler.setSystemEnabled("Second", true);
+        scheduler.run(0.016f);
+        order = log.get();
+        REQUIRE(order.size() == 5);
+        REQUIRE(order[2] == "First");
+        REQUIRE(order[3] == "Second");
+        REQUIRE(order[4] == "Third");
+    }
+
+    SECTION("Without A Pool Systems Run Serially In Registration Order") {
+        SystemScheduler scheduler;
+        scheduler.addSystem({"C", {}, {"X"}, log.entry("C")});
+        scheduler.addSystem({"A", {}, {"Y"}, log.entry("A")});
+        scheduler.addSystem({"B", {}, {"Z"}, log.entry("B")});
+        scheduler.run(0.016f);
+        REQUIRE(log.get() == std::vector<std::string>{"C", "A", "B"});
+    }
+}
+
+TEST_CASE("SystemScheduler Exceptions", "[SystemScheduler]") {
+    SystemScheduler scheduler(std::make_shared<ThreadPool>(2));
+    RunLog log;
+    scheduler.addSystem({"Failing", {}, {"A"}, [](float) { throw std::runtime_error("system failed"); }});
+    scheduler.addSystem({"Dependent", {"A"}, {}, log.entry("Dependent")});
+
+    REQUIRE_THROWS_WITH(scheduler.run(0.016f), "system failed");
+    // Never started, since its dependency threw first
+    REQUIRE(log.get().empty());
+
+    // A failed frame leaves the scheduler usable
+    REQUIRE_THROWS_WITH(scheduler.run(0.016f), "system failed");
+    scheduler.setSystemEnabled("Failing", false);
+    scheduler.run(0.016f);
+    REQUIRE(log.get() == std::vector<std::string>{"Dependent"});
+}
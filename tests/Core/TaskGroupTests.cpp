@@ -0,0 +1,115 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/TaskGroup.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+
+TEST_CASE("TaskGroup Waiting", "[TaskGroup]") {
+    ThreadPool pool(3);
+
+    SECTION("Wait Returns After Every Task Has Run") {
+        TaskGroup group(pool);
+        std::vector<std::atomic<int>> hits(200);
+        for (size_t i = 0; i < hits.size(); ++i) {
+            group.run([&hits, i]() { ++hits[i]; });
+        }
+        group.wait();
+        REQUIRE(group.pendingCount() == 0);
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](const auto& h) { return h.load() == 1; }));
+
+        // A group can be reused after waiting
+        std::atomic<int> second{0};
+        group.run([&second]() { ++second; });
+        group.wait();
+        REQUIRE(second.load() == 1);
+    }
+
+    SECTION("Wait Rethrows The First Exception Once") {
+        TaskGroup group(pool);
+        std::atomic<int> finished{0};
+        group.run([]() { throw std::runtime_error("task failed"); });
+        for (int i = 0; i < 10; ++i) {
+            group.run([&finished]() { ++finished; });
+        }
+        REQUIRE_THROWS_WITH(group.wait(), "task failed");
+        // The other tasks still ran, and the error is not reported again
+        REQUIRE(finished.load() == 10);
+        REQUIRE_NOTHROW(group.wait());
+    }
+
+    SECTION("Destructor Waits For Running Tasks") {
+        std::atomic<int> finished{0};
+        {
+            TaskGroup group(pool);
+            for (int i = 0; i < 4; ++i) {
+                group.run([&finished]() {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    ++finished;
+                });
+            }
+        }
+        REQUIRE(finished.load() == 4);
+    }
+
+    SECTION("Nested Groups On A Single Worker") {
+        ThreadPool single(1);
+        std::atomic<int> inner{0};
+        std::atomic<bool> done{false};
+        // The only worker waits on tasks that only it can run
+        single.post([&]() {
+            TaskGroup outer(single);
+            for (int i = 0; i < 4; ++i) {
+                outer.run([&]() {
+                    TaskGroup nested(single);
+                    for (int j = 0; j < 4; ++j) {
+                        nested.run([&inner]() { ++inner; });
+                    }
+                    nested.wait();
+                });
+            }
+            outer.wait();
+            done = true;
+        });
+        while (!done.load()) {
+            std::this_thread::yield();
+        }
+        REQUIRE(inner.load() == 16);
+    }
+}
+
+TEST_CASE("TaskGroup Shutdown", "[TaskGroup]") {
+    SECTION("Run On A Stopping Pool Throws Without Leaving A Pending Task") {
+        std::atomic<bool> started{false};
+        std::atomic<bool> threw{false};
+        std::atomic<size_t> pendingAfterThrow{1};
+        {
+            ThreadPool pool(1);
+            pool.post([&]() {
+                started = true;
+                // Keeps fanning out until the destructor below stops the pool
+                while (true) {
+                    TaskGroup group(pool);
+                    try {
+                        group.run([]() {});
+                        group.wait();
+                    } catch (const std::runtime_error&) {
+                        threw = true;
+                        pendingAfterThrow = group.pendingCount();
+                        break;
+                    }
+                }
+            });
+            while (!started.load()) {
+                std::this_thread::yield();
+            }
+        }
+        // Reaching here means the group's destructor did not spin
+        REQUIRE(threw.load());
+        REQUIRE(pendingAfterThrow.load() == 0);
+    }
+}
@@ -0,0 +1,210 @@
+#include <catch2/catch.hpp>
+#include "../../src/Core/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ForgeEngine::Core;
+using Clock = std::chrono::steady_clock;
+
+TEST_CASE("ThreadPool Priority Lanes", "[ThreadPool]") {
+    SECTION("Higher Lanes Drain First") {
+        ThreadPool pool(1);
+        std::atomic<bool> release{false};
+        std::mutex orderMutex;
+        std::vector<TaskPriority> order;
+
+        // Park the only worker so everything below is queued before it runs
+        pool.post(TaskPriority::FrameCritical, [&release]() {
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+        });
+
+        for (auto priority : {TaskPriority::Background, TaskPriority::Normal,
+                              TaskPriority::FrameCritical, TaskPriority::Background,
+                              TaskPriority::FrameCritical, TaskPriority::Normal}) {
+            pool.post(priority, [&, priority]() {
+                std::lock_guard<std::mutex> lock(orderMutex);
+                order.push_back(priority);
+            });
+        }
+        release = true;
+
+        while (true) {
+            std::lock_guard<std::mutex> lock(orderMutex);
+            if (order.size() == 6) {
+                break;
+            }
+        }
+
+        REQUIRE(order.size() == 6);
+        REQUIRE(std::is_sorted(order.begin(), order.end()));
+    }
+
+    SECTION("Frame-Critical Latency Under Background Saturation") {
+        const size_t workerCount = 2;
+        const auto backgroundTaskLength = std::chrono::milliseconds(200);
+        ThreadPool pool(workerCount);
+        std::atomic<bool> stopBackground{false};
+
+        // Keep every worker busy with long background jobs that only offer
+        // safe points every millisecond
+        for (size_t i = 0; i < workerCount * 4; ++i) {
+            pool.post(TaskPriority::Background, [&pool, &stopBackground, backgroundTaskLength]() {
+                const auto end = Clock::now() + backgroundTaskLength;
+                while (Clock::now() < end && !stopBackground.load()) {
+                    const auto slice = Clock::now() + std::chrono::milliseconds(1);
+                    while (Clock::now() < slice) {
+                    }
+                    pool.yieldToHigherPriority();
+                }
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        Clock::duration worstLatency{};
+        for (int frame = 0; frame < 20; ++frame) {
+            std::atomic<bool> started{false};
+            Clock::time_point startTime;
+            const auto postTime = Clock::now();
+            pool.post(TaskPriority::FrameCritical, [&]() {
+                startTime = Clock::now();
+                started = true;
+            });
+            while (!started.load()) {
+                std::this_thread::yield();
+            }
+            worstLatency = std::max(worstLatency, startTime - postTime);
+        }
+        stopBackground = true;
+
+        // Without safe points a frame task could wait for a whole background job
+        REQUIRE(worstLatency < backgroundTaskLength / 4);
+    }
+}
+
+TEST_CASE("ThreadPool Task Exceptions", "[ThreadPool]") {
+    SECTION("Worker Survives A Throwing Task") {
+        ThreadPool pool(1);
+        pool.post([]() { throw std::runtime_error("posted task failed"); });
+        REQUIRE(pool.enqueue([]() { return 7; }).get() == 7);
+    }
+
+    SECTION("Waiting Caller Does Not See Other Tasks' Exceptions") {
+        ThreadPool pool(1);
+        std::atomic<bool> parked{false};
+        std::atomic<bool> release{false};
+        pool.post(TaskPriority::FrameCritical, [&parked, &release]() {
+            parked = true;
+            while (!release.load()) {
+                std::this_thread::yield();
+            }
+        });
+        while (!parked.load()) {
+            std::this_thread::yield();
+        }
+
+        // Queued ahead of parallelFor's helper, so the caller runs them
+        // while it waits for that helper
+        std::atomic<int> thrown{0};
+        for (int i = 0; i < 3; ++i) {
+            pool.post(TaskPriority::FrameCritical, [&thrown]() {
+                ++thrown;
+                throw std::runtime_error("unrelated task failed");
+            });
+        }
+
+        std::atomic<int> visited{0};
+        REQUIRE_NOTHROW(pool.parallelFor(0, 100, 1, [&visited](int) { ++visited; }));
+        release = true;
+
+        REQUIRE(visited == 100);
+        REQUIRE(thrown == 3);
+    }
+}
+
+TEST_CASE("ThreadPool Parallel Loops", "[ThreadPool]") {
+    ThreadPool pool(3);
+
+    SECTION("Every Index Runs Exactly Once") {
+        // Grain 0 picks its own; 7 leaves a short last chunk
+        for (size_t grain : {size_t(0), size_t(1), size_t(7), size_t(1000)}) {
+            std::vector<std::atomic<int>> hits(1000);
+            pool.parallelFor(10, 1010, grain, [&hits](int i) { ++hits[i - 10]; });
+            REQUIRE(std::all_of(hits.begin(), hits.end(), [](const auto& h) { return h.load() == 1; }));
+        }
+
+        bool touched = false;
+        pool.parallelFor(5, 5, 1, [&touched](int) { touched = true; });
+        pool.parallelFor(5, 2, 1, [&touched](int) { touched = true; });
+        REQUIRE_FALSE(touched);
+    }
+
+    SECTION("Reduce Matches A Serial Fold") {
+        const auto sum = pool.parallelReduce(size_t(0), size_t(100000), 0, uint64_t(0),
+            [](size_t i) { return uint64_t(i) * i; },
+            [](uint64_t a, uint64_t b) { return a + b; });
+        uint64_t expected = 0;
+        for (uint64_t i = 0; i < 100000; ++i) {
+            expected += i * i;
+        }
+        REQUIRE(sum == expected);
+
+        // Not commutative, so any reordering of the partials would show
+        const auto digits = pool.parallelReduce(0, 20, 3, std::string(),
+            [](int i) { return std::to_string(i % 10); },
+            [](std::string a, std::string b) { return a + b; });
+        REQUIRE(digits == "01234567890123456789");
+
+        REQUIRE(pool.parallelReduce(3, 3, 1, 42, [](int i) { return i; }, std::plus<int>()) == 42);
+    }
+
+    SECTION("Body Exception Is Rethrown To The Caller") {
+        REQUIRE_THROWS_WITH(pool.parallelFor(0, 1000, 1, [](int i) {
+            if (i == 500) {
+                throw std::runtime_error("index 500");
+            }
+        }), "index 500");
+
+        REQUIRE_THROWS_AS(pool.parallelReduce(0, 100, 10, 0,
+            [](int i) -> int { if (i == 42) { throw std::out_of_range("42"); } return i; },
+            std::plus<int>()), std::out_of_range);
+
+        // The pool is still usable afterwards
+        std::atomic<int> after{0};
+        pool.parallelFor(0, 100, 1, [&after](int) { ++after; });
+        REQUIRE(after.load() == 100);
+    }
+
+    SECTION("Nested Loops From Workers") {
+        ThreadPool single(1);
+        std::atomic<bool> done{false};
+        std::atomic<int> inner{0};
+
+        // The only worker runs a loop whose helpers nobody else can pick up
+        single.post([&]() {
+            single.parallelFor(0, 8, 1, [&](int) {
+                single.parallelFor(0, 8, 1, [&inner](int) { ++inner; });
+            });
+            done = true;
+        });
+        while (!done.load()) {
+            std::this_thread::yield();
+        }
+        REQUIRE(inner.load() == 64);
+
+        std::vector<std::atomic<int>> hits(64 * 64);
+        pool.parallelFor(0, 64, 1, [&](int outer) {
+            pool.parallelFor(0, 64, 4, [&](int i) { ++hits[outer * 64 + i]; });
+        });
+        REQUIRE(std::all_of(hits.begin(), hits.end(), [](const auto& h) { return h.load() == 1; }));
+    }
+}
@@ -63,6 +63,17 @@ TEST_CASE("MultiVillageSystem Basic Operations", "[MultiVillageSystem]") {
         REQUIRE(agreements.size() == 1);
         REQUIRE(agreements[0].type == DiplomaticAgreement::Type::Alliance);
     }
+
+    SECTION("Update Without A Thread Pool") {
+        MultiVillageSystem serial(nullptr, env.envSystem, env.techSystem,
+                                  env.tradeSystem, env.storySystem);
+        serial.addVillage("Village1", sf::Vector2f(0, 0));
+        serial.addVillage("Village2", sf::Vector2f(100, 100));
+        REQUIRE(serial.createTradeRoute("Village1", "Village2"));
+
+        serial.update(1.0f);
+        REQUIRE(serial.getVillages().size() == 2);
+    }
 }
 
 TEST_CASE("MultiVillageSystem Resource Management", "[MultiVillageSystem]") {
@@ -98,7 +109,7 @@ TEST_CASE("MultiVillageSystem Technology Diffusion", "[MultiVillageSystem]") {
         
         // Give technology to first village
         auto v1 = env.villageSystem->findVillage("Village1");
-        v1->technologies.push_back("WaterMill");
+        v1->technologies.push_back(ForgeEngine::Core::Symbol("WaterMill"));
         
         // Create good relations
         env.villageSystem->createDiplomaticAgreement(
@@ -117,7 +128,7 @@ TEST_CASE("MultiVillageSystem Technology Diffusion", "[MultiVillageSystem]") {
         bool hasTechnology = std::find(
             v2->technologies.begin(),
             v2->technologies.end(),
-            "WaterMill"
+            ForgeEngine::Core::Symbol("WaterMill")
         ) != v2->technologies.end();
         
         REQUIRE(hasTechnology);
@@ -0,0 +1,162 @@
+#include <catch2/catch.hpp>
+#include "../../src/GameSystems/NPCAdvanced.h"
+#include "../../src/GameSystems/NPCNeeds.h"
+#include "../../src/Core/ThreadPool.h"
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace Forge;
+
+TEST_CASE("NPC Needs Storage", "[NPCNeeds]") {
+    NPCNeedsStorage needs;
+
+    SECTION("Slots Start Rested And Are Reused") {
+        const uint32_t first = needs.allocate();
+        const uint32_t second = needs.allocate();
+        REQUIRE(needs.energy(first) == 1.0f);
+        REQUIRE(needs.workMotivation(second) == 0.5f);
+        REQUIRE(needs.capacity() % NPCNeedsStorage::Lanes == 0);
+
+        needs.hunger(first) = 0.7f;
+        needs.release(first);
+        REQUIRE(needs.size() == 1);
+        const uint32_t reused = needs.allocate();
+        REQUIRE(reused == first);
+        REQUIRE(needs.hunger(reused) == 0.0f);
+    }
+
+    SECTION("Kernel Matches Scalar Reference And Clamps") {
+        std::vector<uint32_t> slots;
+        for (int i = 0; i < 100; ++i) {
+            slots.push_back(needs.allocate());
+            needs.hunger(slots.back()) = i / 100.0f;
+            needs.energy(slots.back()) = 1.0f - i / 100.0f;
+        }
+        std::vector<float> hunger, energy, social, work;
+        for (uint32_t slot : slots) {
+            hunger.push_back(needs.hunger(slot));
+            energy.push_back(needs.energy(slot));
+            social.push_back(needs.socialNeed(slot));
+            work.push_back(needs.workMotivation(slot));
+        }
+
+        for (int tick = 0; tick < 10; ++tick) {
+            needs.advance(10.0f);
+            AdvanceNeedsScalar(hunger.data(), energy.data(), social.data(), work.data(), slots.size(), 10.0f);
+        }
+        for (size_t i = 0; i < slots.size(); ++i) {
+            REQUIRE(needs.hunger(slots[i]) == Approx(hunger[i]));
+            REQUIRE(needs.energy(slots[i]) == Approx(energy[i]));
+            REQUIRE(needs.socialNeed(slots[i]) == Approx(social[i]));
+            REQUIRE(needs.workMotivation(slots[i]) == Approx(work[i]));
+            REQUIRE(needs.hunger(slots[i]) <= 1.0f);
+            REQUIRE(needs.energy(slots[i]) >= 0.0f);
+        }
+    }
+}
+
+TEST_CASE("NPC Needs Threaded Advance", "[NPCNeeds]") {
+    // Past the 4096-slot chunk size, so advance() splits across the pool
+    constexpr int SlotCount = 10000;
+    NPCNeedsStorage needs;
+    ForgeEngine::Core::ThreadPool pool(4);
+    std::vector<float> hunger, energy, social, work;
+    for (int i = 0; i < SlotCount; ++i) {
+        const uint32_t slot = needs.allocate();
+        REQUIRE(slot == static_cast<uint32_t>(i));
+        needs.hunger(slot) = (i % 100) / 100.0f;
+        needs.energy(slot) = 1.0f - (i % 37) / 37.0f;
+        hunger.push_back(needs.hunger(slot));
+        energy.push_back(needs.energy(slot));
+        social.push_back(needs.socialNeed(slot));
+        work.push_back(needs.workMotivation(slot));
+    }
+
+    for (int tick = 0; tick < 10; ++tick) {
+        needs.advance(10.0f, &pool);
+        AdvanceNeedsScalar(hunger.data(), energy.data(), social.data(), work.data(), SlotCount, 10.0f);
+    }
+    for (uint32_t slot = 0; slot < SlotCount; ++slot) {
+        REQUIRE(needs.hunger(slot) == Approx(hunger[slot]));
+        REQUIRE(needs.energy(slot) == Approx(energy[slot]));
+        REQUIRE(needs.socialNeed(slot) == Approx(social[slot]));
+        REQUIRE(needs.workMotivation(slot) == Approx(work[slot]));
+    }
+}
+
+TEST_CASE("NPC Needs Concurrent Allocation", "[NPCNeeds]") {
+    // Several pages' worth of slots allocated while another thread uses the
+    // storage; pages never move, so existing slots stay valid
+    constexpr int SlotCount = 20000;
+    NPCNeedsStorage needs;
+    const uint32_t first = needs.allocate();
+    std::atomic<bool> done{false};
+
+    SECTION("Reading A Slot") {
+        std::atomic<bool> slotUnchanged{true};
+        std::thread reader([&]() {
+            while (!done.load()) {
+                if (needs.energy(first) != 1.0f) {
+                    slotUnchanged = false;
+                }
+            }
+        });
+        for (int i = 1; i < SlotCount; ++i) {
+            needs.allocate();
+        }
+        done = true;
+        reader.join();
+        REQUIRE(slotUnchanged.load());
+    }
+
+    SECTION("Advancing") {
+        ForgeEngine::Core::ThreadPool pool(2);
+        std::thread advancer([&]() {
+            while (!done.load()) {
+                needs.advance(0.0f, &pool);
+            }
+        });
+        for (int i = 1; i < SlotCount; ++i) {
+            needs.allocate();
+        }
+        done = true;
+        advancer.join();
+        REQUIRE(needs.energy(first) == 1.0f);
+    }
+
+    REQUIRE(needs.size() == SlotCount);
+    REQUIRE(needs.workMotivation(SlotCount - 1) == 0.5f);
+}
+
+TEST_CASE("NPC Needs Slot Ownership", "[NPCNeeds]") {
+    NPCNeedsStorage needs;
+    const NPCTraits traits{5, 5, 5, 5};
+
+    SECTION("Move Construction Hands Over The Slot") {
+        {
+            AdvancedNPC original("Mover", traits, needs);
+            needs.hunger(0) = 0.4f;
+            AdvancedNPC moved(std::move(original));
+            REQUIRE(needs.size() == 1);
+            REQUIRE(moved.GetHunger() == 0.4f);
+        }
+        // Released once: two new slots are distinct
+        REQUIRE(needs.size() == 0);
+        REQUIRE(needs.allocate() != needs.allocate());
+    }
+
+    SECTION("Move Assignment Releases The Target's Slot") {
+        {
+            AdvancedNPC first("First", traits, needs);
+            AdvancedNPC second("Second", traits, needs);
+            needs.hunger(1) = 0.8f;
+            first = std::move(second);
+            REQUIRE(needs.size() == 1);
+            REQUIRE(first.GetHunger() == 0.8f);
+        }
+        REQUIRE(needs.size() == 0);
+        REQUIRE(needs.allocate() != needs.allocate());
+    }
+}
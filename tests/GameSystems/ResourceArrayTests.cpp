@@ -0,0 +1,55 @@
+#include <catch2/catch.hpp>
+#include "../../src/GameSystems/ResourceArray.h"
+#include <cstdint>
+
+using namespace Forge;
+
+TEST_CASE("Resource Array", "[ResourceArray]") {
+    ResourceArray<float> stock{
+        {ResourceType::Food, 100.0f},
+        {ResourceType::Tools, 4.0f}
+    };
+
+    SECTION("Indexed By Resource Type") {
+        REQUIRE(stock[ResourceType::Food] == 100.0f);
+        REQUIRE(stock[ResourceType::Wood] == 0.0f);
+        stock[ResourceType::Wood] += 5.0f;
+        REQUIRE(stock[ResourceType::Wood] == 5.0f);
+        REQUIRE(reinterpret_cast<uintptr_t>(&stock[ResourceType::Food]) % 32 == 0);
+    }
+
+    SECTION("Whole-Array Math") {
+        ResourceArray<float> change{
+            {ResourceType::Food, -150.0f},
+            {ResourceType::Cloth, 2.0f}
+        };
+        stock += change * 0.5f;
+        stock.clampNonNegative();
+        REQUIRE(stock[ResourceType::Food] == 25.0f);
+        REQUIRE(stock[ResourceType::Cloth] == 1.0f);
+
+        stock -= change;
+        stock.clampNonNegative();
+        REQUIRE(stock[ResourceType::Food] == 175.0f);
+        REQUIRE(stock[ResourceType::Cloth] == 0.0f);
+        REQUIRE(stock.sum() == 179.0f);
+    }
+
+    SECTION("Dot Product With A Constant Table") {
+        static constexpr ResourceArray<float> prices{
+            {ResourceType::Food, 1.0f},
+            {ResourceType::Tools, 8.0f}
+        };
+        static_assert(prices[ResourceType::Tools] == 8.0f);
+        REQUIRE(dot(stock, prices) == 132.0f);
+    }
+
+    SECTION("Visits Every Resource In Order") {
+        int visited = 0;
+        stock.forEach([&](ResourceType type, float&) {
+            REQUIRE(static_cast<int>(type) == visited);
+            ++visited;
+        });
+        REQUIRE(visited == static_cast<int>(ResourceTypeCount));
+    }
+}